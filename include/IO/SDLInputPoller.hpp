@@ -12,7 +12,7 @@
  */
 class SDLInputPoller : public InputPoller {
    public:
-    std::shared_ptr<const Input> poll(std::shared_ptr<const Input> previous_input) override;
+    Input poll(const Input& previous_input) override;
 };
 
 #endif /* AAB054B7_A6D3_4E3E_A203_66DBAA015871 */
@@ -0,0 +1,28 @@
+#ifndef A1816644_FB87_4750_9255_66552AA10EF4
+#define A1816644_FB87_4750_9255_66552AA10EF4
+
+#include <immer/lock/no_lock_policy.hpp>
+#include <immer/memory_policy.hpp>
+#include <immer/refcount/unsafe_refcount_policy.hpp>
+
+/**
+ * board_memory ― 盤面（BasicTetrisGrid）の immer ノードに使うメモリポリシー
+ *   - 盤面ごとにテンプレート引数で選ぶ。盤面の値をスレッド間で受け渡すかどうかで決める
+ */
+namespace board_memory {
+
+/// immer の既定（参照カウントは atomic、ノードはグローバルなヒープ＋スレッド安全な空きリスト）
+using SharedPolicy = immer::default_memory_policy;
+
+/**
+ * 1 スレッドに閉じた盤面用のポリシー
+ *   - 参照カウントは非 atomic。ノードの確保は immer の既定のヒープ（スレッドごとの空きリスト）のまま
+ *   - この盤面（とそのコピー）を複数のスレッドから同時に触ってはいけない。
+ *     GameFarm のようにスレッドごとに盤面を持つ使い方を想定する
+ */
+using LocalPolicy = immer::memory_policy<immer::default_heap_policy, immer::unsafe_refcount_policy,
+                                         immer::no_lock_policy>;
+
+}  // namespace board_memory
+
+#endif /* A1816644_FB87_4750_9255_66552AA10EF4 */
@@ -1,10 +1,14 @@
 #ifndef B46CA402_5D14_4D1D_9923_49018BA7FA61
 #define B46CA402_5D14_4D1D_9923_49018BA7FA61
 
+#include <array>
 #include <core/GameConfig.hpp>
 #include <core/IRenderer.hpp>
 #include <core/Position.hpp>
+#include <core/Tetrimino.hpp>
 #include <core/graphics_types.hpp>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <tl/expected.hpp>
 
@@ -30,7 +34,7 @@ struct Cell {
         if (this->type == CellStatus::FILLED) {
             renderer.fill_rect(rect, this->color);
         } else {
-            renderer.stroke_rect(rect, Color::from_string("black"));
+            renderer.stroke_rect(rect, colors::kBlack);
         }
     };
 
@@ -72,11 +76,11 @@ static_assert(is_legal_transition(CellStatus::FILLED, CellStatus::EMPTY));
 class CellFactory {
    public:
     const Size size;
-    explicit CellFactory(const GameConfig& cfg) : size{cfg.cell.size} {}
+    explicit CellFactory(const GameConfig& cfg) : size{cfg.cell.size, cfg.cell.size} {}
 
     [[nodiscard]]
     inline Cell create(const Position& pos, CellStatus type, Color color) const {
-        if (type == CellStatus::EMPTY) color = Color::from_string("white");
+        if (type == CellStatus::EMPTY) color = colors::kWhite;
         return Cell{type, pos, size, std::move(color)};
     };
 
@@ -95,11 +99,76 @@ class CellFactory {
 
         // Empty → 常に白
         if (new_state == CellStatus::EMPTY) {
-            new_color = Color::from_string("white");
+            new_color = colors::kWhite;
         }
 
         return Cell{new_state, cell.position, cell.size, std::move(new_color)};
     };
 };
 
+// ────────────────── 盤面保存用のコンパクト表現 ──────────────────
+namespace cell_palette {
+
+/// セル色のパレット。0 は EMPTY の白、1..7 は tetrimino::kColors と同じ並び
+constexpr std::array<Color, 8> kColors{{colors::kWhite,
+                                        tetrimino::kColors[0],
+                                        tetrimino::kColors[1],
+                                        tetrimino::kColors[2],
+                                        tetrimino::kColors[3],
+                                        tetrimino::kColors[4],
+                                        tetrimino::kColors[5],
+                                        tetrimino::kColors[6]}};
+
+constexpr std::uint8_t kEmptyIndex = 0;
+
+/// パレット上のインデックスを探す（パレットにない色は std::nullopt）
+constexpr std::optional<std::uint8_t> index_of(Color color) noexcept {
+    for (std::size_t i = 0; i < kColors.size(); ++i) {
+        const Color& c = kColors[i];
+        if (c.r == color.r && c.g == color.g && c.b == color.b && c.a == color.a) {
+            return static_cast<std::uint8_t>(i);
+        }
+    }
+    return std::nullopt;
+}
+
+/// テトリミノの種類に対応するパレットインデックス
+constexpr std::uint8_t index_of(TetriminoType type) noexcept {
+    return static_cast<std::uint8_t>(static_cast<std::uint8_t>(type) + 1);
+}
+
+static_assert(index_of(tetrimino::color_of(TetriminoType::L)) == index_of(TetriminoType::L));
+static_assert(!index_of(Color{1, 2, 3, 255}).has_value());
+
+}  // namespace cell_palette
+
+/**
+ * PackedCell ― 盤面に保存する 1 バイトのセル
+ *   - 下位 2 bit: CellStatus
+ *   - 上位 3 bit: cell_palette::kColors のインデックス
+ *   - 座標・サイズは持たない。盤面の原点・行列・CellFactory::size から都度求める
+ *   - 値初期化（bits == 0）は白の EMPTY
+ */
+struct PackedCell {
+    std::uint8_t bits{0};
+
+    [[nodiscard]] static constexpr PackedCell make(CellStatus status,
+                                                   std::uint8_t palette_index) noexcept {
+        return PackedCell{static_cast<std::uint8_t>(static_cast<std::uint8_t>(status) |
+                                                    (palette_index << 2))};
+    }
+
+    constexpr CellStatus status() const noexcept { return static_cast<CellStatus>(bits & 0x3); }
+    constexpr std::uint8_t palette_index() const noexcept {
+        return static_cast<std::uint8_t>(bits >> 2);
+    }
+    constexpr Color color() const noexcept { return cell_palette::kColors[palette_index()]; }
+};
+
+static_assert(sizeof(PackedCell) == 1);
+static_assert(std::is_copy_assignable_v<PackedCell>);
+static_assert(PackedCell{}.status() == CellStatus::EMPTY && PackedCell{}.palette_index() == 0);
+static_assert(PackedCell::make(CellStatus::FILLED, 7).status() == CellStatus::FILLED &&
+              PackedCell::make(CellStatus::FILLED, 7).palette_index() == 7);
+
 #endif /* B46CA402_5D14_4D1D_9923_49018BA7FA61 */
@@ -0,0 +1,60 @@
+#ifndef B7E1C3F9_2D48_4A6B_9C05_E8F4A1D26B73
+#define B7E1C3F9_2D48_4A6B_9C05_E8F4A1D26B73
+
+#include <cstdint>
+
+// ────────────────── 固定ステップ定数 ──────────────────
+// ゲームロジックはすべてこのティックで進める。描画のフレームレートとは独立。
+namespace timestep {
+/// 1 ティックの長さ [ms]。整数にしておくとロジック側の累積に誤差が出ない
+constexpr std::uint32_t kTickMillis = 8;
+constexpr int kTicksPerSecond = 1000 / static_cast<int>(kTickMillis);  // 125 Hz
+constexpr double kTickSeconds = kTickMillis / 1000.0;
+/// 1 フレームで追いつく最大ティック数（これを超えた遅れは捨てる）
+constexpr int kMaxStepsPerFrame = 8;
+/// 1 フレームとして受け付ける最大の経過時間 [s]（ブレークポイントやタブ復帰時の巨大な dt 対策）
+constexpr double kMaxFrameSeconds = 0.25;
+
+static_assert(1000 % kTickMillis == 0, "1 秒が整数ティックになること");
+}  // namespace timestep
+
+/**
+ * FrameSteps ― 1 描画フレーム分の進め方
+ *   - steps: このフレームで回すロジックのティック数
+ *   - alpha: 最後のティックから次のティックまでの進み具合 [0, 1)。描画の補間に使う
+ */
+struct FrameSteps {
+    int steps;
+    double alpha;
+};
+
+/**
+ * FixedStepDriver ― 可変の実時間を固定長のティック数に変換するアキュムレータ
+ *   - 実時間はここでしか扱わない。ロジックには常に同じ長さのティックが渡る
+ *   - 遅れが kMaxStepsPerFrame を超えたら余りを捨てて追いつく（処理落ちの連鎖を防ぐ）
+ *   - デスクトップの runLoop と Emscripten の frame_cb の両方から Game::tick 経由で使う
+ */
+class FixedStepDriver {
+   public:
+    explicit FixedStepDriver(double step_seconds = timestep::kTickSeconds,
+                             int max_steps_per_frame = timestep::kMaxStepsPerFrame) noexcept
+        : step_seconds_(step_seconds), max_steps_per_frame_(max_steps_per_frame) {}
+
+    /**
+     * 経過時間を積み、回すべきティック数と補間係数を返す
+     * @param elapsed_seconds 前フレームからの実時間 [s]（負・NaN は 0 とみなす）
+     */
+    FrameSteps advance(double elapsed_seconds) noexcept;
+
+    [[nodiscard]] double step_seconds() const noexcept { return step_seconds_; }
+    /// これまでに回したティックの総数
+    [[nodiscard]] std::uint64_t total_steps() const noexcept { return total_steps_; }
+
+   private:
+    double step_seconds_;
+    int max_steps_per_frame_;
+    double accumulator_ = 0.0;
+    std::uint64_t total_steps_ = 0;
+};
+
+#endif /* B7E1C3F9_2D48_4A6B_9C05_E8F4A1D26B73 */
@@ -0,0 +1,162 @@
+#ifndef C5E2A7B4_9F36_4D81_B0C7_6A3D8E1F2B59
+#define C5E2A7B4_9F36_4D81_B0C7_6A3D8E1F2B59
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// フレーム計測の有効・無効（CMake の TETRIS_FRAME_METRICS オプションで切り替える）。
+// 0 のとき Game は計測用のメンバも時計の読み取りも持たない。
+#ifndef TETRIS_FRAME_METRICS
+#define TETRIS_FRAME_METRICS 0
+#endif
+
+/**
+ * Game::tick の計測区間
+ *   - END_FRAME には Present（垂直同期の待ち）を含む
+ *   - FRAME は tick 全体
+ */
+enum class FramePhase : std::uint8_t {
+    INPUT,
+    UPDATE,
+    BEGIN_FRAME,
+    CLEAR,
+    RENDER,
+    END_FRAME,
+    FRAME
+};
+
+constexpr std::size_t kFramePhaseCount = static_cast<std::size_t>(FramePhase::FRAME) + 1;
+
+/// 計測区間の名前（ログ出力用）
+constexpr const char* to_string(FramePhase phase) noexcept {
+    constexpr const char* kNames[kFramePhaseCount] = {"input",     "update", "begin_frame",
+                                                      "clear",     "render", "end_frame",
+                                                      "frame"};
+    return kNames[static_cast<std::size_t>(phase)];
+}
+
+/**
+ * PhaseSummary ― 1 区間の集計結果（単位はマイクロ秒）
+ *   - p50 / p99 はバケットの上端なので、実測値以上の値を返す（誤差は 1/8 以下）
+ */
+struct PhaseSummary {
+    std::uint64_t count;
+    double mean_us;
+    std::uint64_t p50_us;
+    std::uint64_t p99_us;
+    std::uint64_t max_us;
+};
+
+/**
+ * LatencyHistogram ― 固定長・ロックフリーの所要時間ヒストグラム
+ *   - 16 µs 未満は 1 µs 刻み、それ以上は 2 の冪ごとに 8 分割（相対誤差 12.5% 以内）
+ *   - 記録は relaxed な fetch_add のみ。描画スレッドと集計スレッドが別でもロックを取らない
+ *   - 上限（約 16 秒）を超える値は最後のバケットに入れる
+ */
+class LatencyHistogram {
+   public:
+    static constexpr int kLinearBits = 4;
+    static constexpr int kSubBuckets = 8;
+    static constexpr int kMaxExponent = 24;
+    static constexpr std::size_t kBucketCount =
+        (1u << kLinearBits) + (kMaxExponent - kLinearBits) * kSubBuckets;
+
+    void record(std::uint64_t micros) noexcept;
+
+    [[nodiscard]] PhaseSummary summarize() const noexcept;
+
+    /// 記録をすべて消す（記録中のスレッドがあると一部が残ることがある）
+    void reset() noexcept;
+
+    /// 値が入るバケット
+    static constexpr std::size_t bucket_of(std::uint64_t micros) noexcept {
+        if (micros < (1u << kLinearBits)) return static_cast<std::size_t>(micros);
+        int exponent = 0;
+        while ((micros >> (exponent + 1)) != 0) ++exponent;
+        if (exponent >= kMaxExponent) return kBucketCount - 1;
+        const std::uint64_t sub = (micros >> (exponent - 3)) & (kSubBuckets - 1);
+        const auto octave = static_cast<std::size_t>(exponent - kLinearBits);
+        return (1u << kLinearBits) + octave * kSubBuckets + static_cast<std::size_t>(sub);
+    }
+
+    /// バケットに入る最大値
+    static constexpr std::uint64_t upper_bound_of(std::size_t bucket) noexcept {
+        if (bucket < (1u << kLinearBits)) return bucket;
+        const std::size_t offset = bucket - (1u << kLinearBits);
+        const int exponent = static_cast<int>(offset / kSubBuckets) + kLinearBits;
+        const std::uint64_t sub = offset % kSubBuckets;
+        return ((kSubBuckets + sub + 1) << (exponent - 3)) - 1;
+    }
+
+   private:
+    std::array<std::atomic<std::uint32_t>, kBucketCount> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> sum_{0};
+    std::atomic<std::uint64_t> max_{0};
+};
+
+static_assert(LatencyHistogram::bucket_of(15) == 15);
+static_assert(LatencyHistogram::bucket_of(16) == 16 && LatencyHistogram::upper_bound_of(16) == 17);
+static_assert(LatencyHistogram::upper_bound_of(LatencyHistogram::bucket_of(1000)) >= 1000);
+static_assert(LatencyHistogram::upper_bound_of(LatencyHistogram::bucket_of(16667)) < 16667 * 9 / 8);
+
+/**
+ * FrameMetrics ― Game::tick の区間ごとのヒストグラムとフレーム数
+ */
+class FrameMetrics {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    void record(FramePhase phase, Clock::duration elapsed) noexcept {
+        const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        histograms_[static_cast<std::size_t>(phase)].record(
+            micros > 0 ? static_cast<std::uint64_t>(micros) : 0);
+    }
+
+    [[nodiscard]] PhaseSummary summary(FramePhase phase) const noexcept {
+        return histograms_[static_cast<std::size_t>(phase)].summarize();
+    }
+
+    /// 計測したフレーム数（FRAME 区間の記録数）
+    [[nodiscard]] std::uint64_t frames() const noexcept { return summary(FramePhase::FRAME).count; }
+
+    void reset() noexcept {
+        for (auto& histogram : histograms_) histogram.reset();
+    }
+
+   private:
+    std::array<LatencyHistogram, kFramePhaseCount> histograms_;
+};
+
+/**
+ * PhaseTimer ― スコープの所要時間を FrameMetrics に記録する
+ */
+class PhaseTimer {
+   public:
+    PhaseTimer(FrameMetrics& metrics, FramePhase phase) noexcept
+        : metrics_(metrics), phase_(phase), start_(FrameMetrics::Clock::now()) {}
+    ~PhaseTimer() { metrics_.record(phase_, FrameMetrics::Clock::now() - start_); }
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+   private:
+    FrameMetrics& metrics_;
+    FramePhase phase_;
+    FrameMetrics::Clock::time_point start_;
+};
+
+// スコープ計測。TETRIS_FRAME_METRICS が 0 なら何も生成しない
+#define TETRIS_FRAME_PHASE_CONCAT_(a, b) a##b
+#define TETRIS_FRAME_PHASE_NAME_(line) TETRIS_FRAME_PHASE_CONCAT_(frame_phase_timer_, line)
+#if TETRIS_FRAME_METRICS
+#define TETRIS_FRAME_PHASE(metrics, phase) \
+    PhaseTimer TETRIS_FRAME_PHASE_NAME_(__LINE__) { metrics, phase }
+#else
+#define TETRIS_FRAME_PHASE(metrics, phase) static_cast<void>(0)
+#endif
+
+#endif /* C5E2A7B4_9F36_4D81_B0C7_6A3D8E1F2B59 */
@@ -0,0 +1,111 @@
+#ifndef F3A8D6C2_7B19_4E05_8D4C_2A6E9F1B5C07
+#define F3A8D6C2_7B19_4E05_8D4C_2A6E9F1B5C07
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * フレームの待ち方
+ *   - VSYNC: 待たない。Present がディスプレイの垂直同期で待つ（二重待ちを避ける）
+ *   - UNCAPPED: 待たない。計測のみ
+ *   - TARGET_FPS: 目標フレームレートの締め切りまで sleep → spin で待つ
+ */
+enum class PacingMode { VSYNC, UNCAPPED, TARGET_FPS };
+
+/**
+ * FrameTimeStats ― フレーム時間の統計（Welford 法で平均・分散を逐次更新）
+ *   - 単位はミリ秒
+ *   - stddev_ms() がフレーム時間のジッタ
+ */
+struct FrameTimeStats {
+    std::uint64_t count = 0;
+    double mean_ms = 0.0;
+    double m2 = 0.0;  ///< 平均からの偏差の二乗和
+    double min_ms = 0.0;
+    double max_ms = 0.0;
+
+    void add(double ms) noexcept {
+        ++count;
+        const double delta = ms - mean_ms;
+        mean_ms += delta / static_cast<double>(count);
+        m2 += delta * (ms - mean_ms);
+        if (count == 1 || ms < min_ms) min_ms = ms;
+        if (count == 1 || ms > max_ms) max_ms = ms;
+    }
+
+    [[nodiscard]] double variance_ms2() const noexcept {
+        return count > 1 ? m2 / static_cast<double>(count - 1) : 0.0;
+    }
+
+    [[nodiscard]] double stddev_ms() const noexcept;
+};
+
+namespace frame_pacing {
+using Clock = std::chrono::steady_clock;
+
+/// sleep を切り上げて spin に移る、締め切りまでの残り時間（OS のスリープ粒度を吸収する幅）
+constexpr std::chrono::microseconds kDefaultSpinThreshold{1000};
+/// spin に使う時間の上限。寝過ごしが大きい環境でも、1 フレームで CPU を回すのはここまで
+constexpr std::chrono::microseconds kMaxSpinThreshold{2000};
+
+/**
+ * 締め切りまで待つ（前半は sleep_until、最後の spin_threshold はビジーウェイト）
+ *   - 締め切りより前には戻らない
+ * @return sleep が目標（deadline - spin_threshold）より何マイクロ秒遅れて起きたか（眠らなければ 0）
+ */
+std::chrono::microseconds wait_until(
+    Clock::time_point deadline, std::chrono::microseconds spin_threshold = kDefaultSpinThreshold);
+}  // namespace frame_pacing
+
+/**
+ * FramePacer ― steady_clock を基準にしたフレームペーシング
+ *   - wait_for_next_frame() をフレーム先頭で 1 回呼ぶ。必要なら待ってから前フレームからの経過秒を返す
+ *   - TARGET_FPS では締め切りを周期ぶん進めていく（待ち時間の誤差が次フレームに累積しない）
+ *   - 1 周期以上遅れたら締め切りを現在時刻に合わせ直す（追いつくための連続フレームを出さない）
+ *   - sleep の寝過ごしを計測し、spin に移る幅を「平均 + 3σ」まで広げる。
+ *     スケジューラの粒度が粗い環境でも締め切りを越えて起きにくくする。
+ *     幅は kMaxSpinThreshold と周期の半分の小さい方で打ち切り、spin で CPU を焼きすぎない
+ *   - すべてのモードで計測したフレーム時間を FrameTimeStats に積む
+ */
+class FramePacer {
+   public:
+    explicit FramePacer(
+        PacingMode mode = PacingMode::VSYNC, double target_fps = 60.0,
+        std::chrono::microseconds spin_threshold = frame_pacing::kDefaultSpinThreshold) noexcept;
+
+    /// 待ち方を切り替える（実行中に変更してよい）
+    void set_mode(PacingMode mode) noexcept;
+    void set_target_fps(double target_fps) noexcept;
+
+    [[nodiscard]] PacingMode mode() const noexcept { return mode_; }
+    [[nodiscard]] double target_fps() const noexcept { return target_fps_; }
+
+    /**
+     * 次のフレームの開始まで待つ
+     * @return 前回の呼び出しからの経過時間 [s]
+     */
+    double wait_for_next_frame();
+
+    [[nodiscard]] const FrameTimeStats& stats() const noexcept { return stats_; }
+    /// 今 spin に使っている幅（寝過ごしに合わせて広げた後の値）
+    [[nodiscard]] std::chrono::microseconds spin_threshold() const noexcept {
+        return adaptive_spin_;
+    }
+    void reset_stats() noexcept { stats_ = FrameTimeStats{}; }
+
+   private:
+    PacingMode mode_;
+    double target_fps_;
+    std::chrono::microseconds spin_threshold_;
+    frame_pacing::Clock::duration period_;
+    frame_pacing::Clock::time_point deadline_;
+    frame_pacing::Clock::time_point last_frame_;
+    FrameTimeStats stats_;
+    FrameTimeStats oversleep_;  ///< sleep の寝過ごし量 [ms]
+    std::chrono::microseconds adaptive_spin_;
+
+    [[nodiscard]] std::chrono::microseconds spin_cap() const noexcept;
+    void adapt_spin_threshold() noexcept;
+};
+
+#endif /* F3A8D6C2_7B19_4E05_8D4C_2A6E9F1B5C07 */
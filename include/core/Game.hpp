@@ -2,10 +2,14 @@
 #define CECD6737_285E_48BD_BE62_13103B0254DC
 
 #include <IO/SDLInputPoller.hpp>
+#include <core/FixedStepDriver.hpp>
+#include <core/FrameMetrics.hpp>
+#include <core/FramePacer.hpp>
 #include <core/GameConfig.hpp>
 #include <core/scene/IScene.hpp>
 #include <core/scene/SceneManager.hpp>
 #include <memory>
+#include <optional>
 
 /**
  * Game ― ゲームのメインクラス
@@ -21,7 +25,9 @@ class Game {
         : config_(config),
           scene_manager_(std::move(scene_manager)),
           renderer_(std::move(renderer)),
-          current_input_(std::make_shared<Input>()),
+          current_input_{},
+          pending_input_{},
+          pacer_(PacingMode::VSYNC, config->frame_rate.frame_rate),
           input_poller_(std::move(input_poller)) {}
 
     // ゲームの初期化処理
@@ -30,13 +36,62 @@ class Game {
     // デスクトップ環境でのゲームループ
     void runLoop();
 #endif
-    void tick(double deltaTime);  // 1フレーム処理（全環境共通）
+    /**
+     * 1フレーム処理（全環境共通）
+     *   - 実時間 deltaTime [s] を FixedStepDriver で固定ティック数に変換し、その回数だけ更新する
+     *   - 描画は 1 フレーム 1 回。ティック間の補間係数をシーンに渡す
+     */
+    void tick(double deltaTime);
+
+    /**
+     * フレームの待ち方を切り替える（デスクトップの runLoop 用。実行中に変更してよい）
+     *   - VSYNC: レンダラの垂直同期に任せ、ループ側では待たない。垂直同期を使えない場合は
+     *            設定のフレームレートで TARGET_FPS にフォールバックする
+     *   - UNCAPPED / TARGET_FPS: レンダラの垂直同期を切り、二重に待たないようにする
+     * @return 実際に使うモード
+     */
+    PacingMode set_pacing_mode(PacingMode mode);
+
+    /// runLoop で計測したフレーム時間の統計（平均・ジッタ）
+    [[nodiscard]] const FrameTimeStats& frame_time_stats() const noexcept {
+        return pacer_.stats();
+    }
+
+    /**
+     * tick の区間ごとの所要時間（p50 / p99 / 最大 [µs] と記録数）
+     * @return TETRIS_FRAME_METRICS を無効にしてビルドした場合は std::nullopt
+     */
+    [[nodiscard]] std::optional<PhaseSummary> frame_phase_summary(FramePhase phase) const noexcept {
+#if TETRIS_FRAME_METRICS
+        return frame_metrics_.summary(phase);
+#else
+        static_cast<void>(phase);
+        return std::nullopt;
+#endif
+    }
+
+    /// 区間計測の記録を消す（計測無効時は何もしない）
+    void reset_frame_metrics() noexcept {
+#if TETRIS_FRAME_METRICS
+        frame_metrics_.reset();
+#endif
+    }
+
+    /// QUIT が押されたか
+    [[nodiscard]] bool is_quit_requested() const noexcept { return quit_requested_; }
 
    private:
     std::shared_ptr<const GameConfig> config_;  // ゲーム設定の共有ポインタ
     std::unique_ptr<SceneManager> scene_manager_;
     std::unique_ptr<IRenderer> renderer_;  // レンダラーのユニークポインタ
-    std::shared_ptr<const Input> current_input_;
+    Input current_input_;  ///< 前フレームの入力（値で保持）
+    Input pending_input_;  ///< まだティックに渡していない押下・解放
+    FixedStepDriver step_driver_;
+    FramePacer pacer_;
+    bool quit_requested_ = false;
+#if TETRIS_FRAME_METRICS
+    FrameMetrics frame_metrics_;
+#endif
     std::unique_ptr<InputPoller> input_poller_;
     double last_update_time_ = 0.0;
     // ゲームの更新処理
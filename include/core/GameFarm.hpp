@@ -0,0 +1,99 @@
+#ifndef A9D3F1E6_5B27_4C80_8E4A_3C6B0F2D7E91
+#define A9D3F1E6_5B27_4C80_8E4A_3C6B0F2D7E91
+
+#include <core/GameConfig.hpp>
+#include <core/Input.hpp>
+#include <core/TetrisSimulation.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <tl/expected.hpp>
+#include <vector>
+
+/**
+ * GameJob ― ファームで回す 1 ゲーム分の指定
+ *   - seed: テトリミノ出現順と入力ポリシーのシード
+ *   - max_ticks: 打ち切りティック数（トップアウトしなくてもここで終える）
+ */
+struct GameJob {
+    std::uint32_t seed;
+    std::uint64_t max_ticks;
+};
+
+/**
+ * GameResult ― 1 ゲーム分の結果
+ *   - ticks: トップアウトしたティック（topped_out == false なら打ち切り時のティック）
+ */
+struct GameResult {
+    std::uint32_t seed;
+    int lines_cleared;
+    int pieces_locked;
+    std::uint64_t ticks;
+    bool topped_out;
+};
+
+/**
+ * WorkerStats ― ワーカー 1 つ分の実行統計（スケジュールで変わるので集計値とは分けて持つ）
+ *   - games: このワーカーが回したゲーム数
+ *   - stolen_chunks: 他のワーカーの区間から盗んだチャンク数
+ */
+struct WorkerStats {
+    std::size_t games;
+    std::size_t stolen_chunks;
+};
+
+/**
+ * FarmSummary ― 全ゲームの集計
+ *   - results はジョブと同じ並び。スレッド数やスケジュールによらず同じ値になる
+ *   - 合計値は results をジョブ順に足したもの
+ *   - workers は実際に動いたワーカーごとの統計（ワーカー番号順）
+ */
+struct FarmSummary {
+    std::vector<GameResult> results;
+    std::uint64_t total_lines;
+    std::uint64_t total_pieces;
+    std::uint64_t total_ticks;
+    std::size_t topped_out_games;
+    std::vector<WorkerStats> workers;
+};
+
+/**
+ * GameFarm ― 独立したシード付きゲームを全コアで回すバッチ実行器
+ *   - ジョブを小さなチャンクに分け、チャンク番号の連続した区間を各ワーカーに配る。
+ *     空いたワーカーは他のワーカーの区間の反対側から盗む（ワークスティーリング）。
+ *     区間の取り出しは CAS だけで、ロックを取らない
+ *   - 1 ゲームは開始から終了まで 1 つのワーカーで回す。盤面は LocalTetrisGrid なので
+ *     参照カウントは非 atomic で、ワーカー同士は参照カウントのキャッシュラインを取り合わない。
+ *     解放されたノードは immer の既定のヒープがスレッドごとの空きリストで使い回す
+ *   - 結果はジョブのインデックスの位置に書き込み、集計は全ワーカー終了後にジョブ順で行う
+ */
+class GameFarm {
+   public:
+    /// 1 ティック分の入力を決めるポリシー（1 ゲーム内でだけ使うので状態を持ってよい）
+    using Policy = std::function<Input(const TetrisSimulation&)>;
+    /// ゲームごとにポリシーを作る。複数のワーカーから同時に呼ばれる
+    using PolicyFactory = std::function<Policy(std::uint32_t seed)>;
+
+    /**
+     * @param threads ワーカー数（0 ならハードウェアのスレッド数）
+     * @param chunk_size 1 回に取り出す・盗むジョブ数
+     */
+    explicit GameFarm(unsigned threads = 0, std::size_t chunk_size = 16);
+
+    [[nodiscard]] unsigned thread_count() const noexcept { return threads_; }
+
+    /**
+     * 全ジョブを回して集計する
+     * @return 成功時は集計結果、設定から盤面を作れない場合はエラーメッセージ
+     */
+    [[nodiscard]] tl::expected<FarmSummary, std::string> run(
+        const GameConfig& config, const std::vector<GameJob>& jobs,
+        const PolicyFactory& policy_factory) const;
+
+   private:
+    unsigned threads_;
+    std::size_t chunk_size_;
+};
+
+#endif /* A9D3F1E6_5B27_4C80_8E4A_3C6B0F2D7E91 */
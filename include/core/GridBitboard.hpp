@@ -0,0 +1,234 @@
+#ifndef C1E0B7A4_3F2D_4A8E_9B61_5D7E2C94A0F3
+#define C1E0B7A4_3F2D_4A8E_9B61_5D7E2C94A0F3
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <core/Cell.hpp>
+#include <core/Tetrimino.hpp>
+
+// ────────────────── ビットボード定数 ──────────────────
+namespace grid_bitboard {
+
+/// 1 行分の占有ビット（wasm32 のネイティブワード幅に合わせて 32bit）
+using BitRow = std::uint32_t;
+
+constexpr int kRowBits = 32;
+/// 左壁のビット数。4x4 のピース枠が盤面の左へはみ出してもシフト量が負にならない幅。
+constexpr int kWallBits = 3;
+/// 盤面の最大列数（左壁 + 列 + 右壁 + 4x4 枠のはみ出しが 1 ワードに収まる範囲）
+constexpr int kMaxColumns = 16;
+/// 盤面の最大行数
+constexpr int kMaxRows = 32;
+/// 盤面の下に置く床（番兵）行数。4x4 枠の最下段が床を越えても配列外に出ない。
+constexpr int kFloorRows = 4;
+constexpr std::size_t kStorageRows = kMaxRows + kFloorRows;
+
+constexpr BitRow kFullRow = ~BitRow{0};
+
+static_assert(kWallBits + kMaxColumns + kWallBits + 3 <= kRowBits,
+              "4x4 の枠が右壁を越えてもワード内に収まること");
+
+/// 列 column に対応するビット
+constexpr BitRow column_bit(int column) noexcept { return BitRow{1} << (column + kWallBits); }
+
+/// 盤面内の列だけを立てたマスク
+constexpr BitRow columns_mask(int columns) noexcept {
+    return ((BitRow{1} << columns) - 1) << kWallBits;
+}
+
+/// 壁（盤面外の列）を立てた行。空行の初期値として使う。
+constexpr BitRow wall_row(int columns) noexcept { return ~columns_mask(columns); }
+
+static_assert(wall_row(10) == 0xFFFFE007u);
+static_assert((wall_row(10) & column_bit(0)) == 0 && (wall_row(10) & column_bit(9)) == 0);
+static_assert((wall_row(10) & column_bit(-1)) != 0 && (wall_row(10) & column_bit(10)) != 0);
+
+}  // namespace grid_bitboard
+
+/**
+ * GridBitboard ― 盤面の占有状態を 1 行 1 ワードに詰めた値オブジェクト
+ *   - filled: FILLED のセルと壁・床の番兵
+ *   - moving: MOVING のセル
+ *   - surface: 列ごとの最上段の FILLED の行（空の列は rows = 床の行）。セル更新のたびに差分で保つ
+ *   - 盤面外（壁・床・天井）は常に占有として扱うので、衝突判定は範囲チェックなしのビット演算で済む
+ *   - TetrisGrid::cells と常に同期させる（TetrisGrid 経由でのみ更新する）
+ */
+struct GridBitboard {
+    using BitRow = grid_bitboard::BitRow;
+    using Rows = std::array<BitRow, grid_bitboard::kStorageRows>;
+    using Surface = std::array<std::int8_t, grid_bitboard::kMaxColumns>;
+
+    int columns;
+    int rows;
+    Rows filled;
+    Rows moving;
+    Surface surface;
+
+    /// 全セル EMPTY の盤面を生成
+    [[nodiscard]] static constexpr GridBitboard empty(int columns, int rows) noexcept {
+        GridBitboard board{columns, rows, {}, {}, {}};
+        for (std::size_t row = 0; row < board.filled.size(); ++row) {
+            board.filled[row] = static_cast<int>(row) < rows ? grid_bitboard::wall_row(columns)
+                                                              : grid_bitboard::kFullRow;
+            board.moving[row] = 0;
+        }
+        for (auto& top : board.surface) top = static_cast<std::int8_t>(rows);
+        return board;
+    }
+
+    /// 盤面内のインデックスか（符号なし比較 2 回）
+    constexpr bool contains(int column, int row) const noexcept {
+        return static_cast<unsigned>(column) < static_cast<unsigned>(columns) &&
+               static_cast<unsigned>(row) < static_cast<unsigned>(rows);
+    }
+
+    /// FILLED と壁・床の行マスク。配列外の行（天井より上・床より下）は全ビット占有。
+    constexpr BitRow filled_row(int row) const noexcept {
+        return static_cast<unsigned>(row) < filled.size() ? filled[row] : grid_bitboard::kFullRow;
+    }
+
+    /// EMPTY 以外のセルと壁・床の行マスク
+    constexpr BitRow occupied_row(int row) const noexcept {
+        return static_cast<unsigned>(row) < filled.size() ? (filled[row] | moving[row])
+                                                          : grid_bitboard::kFullRow;
+    }
+
+    /// 盤面内かつ FILLED か
+    constexpr bool is_filled(int column, int row) const noexcept {
+        return contains(column, row) && (filled[row] & grid_bitboard::column_bit(column)) != 0;
+    }
+
+    /// 盤面外、または EMPTY 以外のセルか
+    constexpr bool is_blocked(int column, int row) const noexcept {
+        const int bit = column + grid_bitboard::kWallBits;
+        return static_cast<unsigned>(bit) >= static_cast<unsigned>(grid_bitboard::kRowBits) ||
+               ((occupied_row(row) >> bit) & 1u) != 0;
+    }
+
+    /**
+     * 4x4 のピースが FILLED・壁・床と重なるか
+     *   - MOVING は操作中ピース自身の描画なので照合しない
+     * @param masks ピースの行マスク
+     * @param column 4x4 枠の左上の列
+     * @param row 4x4 枠の左上の行
+     */
+    constexpr bool overlaps(const tetrimino::RowMask4& masks, int column, int row) const noexcept {
+        const int shift = column + grid_bitboard::kWallBits;
+        // 枠の位置がワード外 → ピースのセルはすべて盤面外
+        if (static_cast<unsigned>(shift) > static_cast<unsigned>(grid_bitboard::kRowBits - 4)) {
+            return true;
+        }
+        BitRow hit = 0;
+        for (int i = 0; i < 4; ++i) {
+            hit |= filled_row(row + i) & (BitRow{masks[i]} << shift);
+        }
+        return hit != 0;
+    }
+
+    /**
+     * 4x4 のピースを何行落とせるか（FILLED・床に当たる直前まで）
+     *   - 各列の最下段セルと surface の差の最小値なので O(4)
+     *   - ピースのセルが surface より下にある（張り出しの下に潜り込んだ）列があるときは、
+     *     surface では判断できないのでビットボードを 1 行ずつ照合する
+     * @param bottom ピースの列ごとの最下段
+     * @param masks ピースの行マスク
+     * @param column 4x4 枠の左上の列
+     * @param row 4x4 枠の左上の行
+     * @pre !overlaps(masks, column, row)
+     */
+    constexpr int drop_distance(const tetrimino::BottomProfile& bottom,
+                                const tetrimino::RowMask4& masks, int column,
+                                int row) const noexcept {
+        int distance = grid_bitboard::kMaxRows + grid_bitboard::kFloorRows;
+        bool exact = true;
+        for (int x = 0; x < 4; ++x) {
+            if (bottom[x] < 0) continue;
+            const int board_column = column + x;
+            const int lowest = row + bottom[x];
+            if (!contains(board_column, 0) || lowest >= surface[board_column]) {
+                exact = false;
+                break;
+            }
+            const int gap = surface[board_column] - 1 - lowest;
+            if (gap < distance) distance = gap;
+        }
+        if (exact) return distance;
+
+        int fallback = 0;
+        while (!overlaps(masks, column, row + fallback + 1)) ++fallback;
+        return fallback;
+    }
+
+    /// 列 column の surface を row より下から探し直す（FILLED を消したときだけ使う）
+    constexpr void rescan_surface(int column, int from_row) noexcept {
+        const BitRow bit = grid_bitboard::column_bit(column);
+        int top = from_row;
+        while (top < rows && (filled[top] & bit) == 0) ++top;
+        surface[column] = static_cast<std::int8_t>(top);
+    }
+
+    /// 全列の surface を filled から作り直す（行消去など複数行がまとめて動いたとき）
+    constexpr void rebuild_surface() noexcept {
+        for (int column = 0; column < columns; ++column) rescan_surface(column, 0);
+    }
+
+    /**
+     * 1 セルの状態をその場で書き換える（まとめて更新する途中の作業用）
+     *   - surface も差分で更新する。FILLED が増えたときは比較 1 回、
+     *     最上段の FILLED が消えたときだけその列を下へ探し直す
+     * @pre contains(column, row)
+     */
+    constexpr void assign(int column, int row, CellStatus status) noexcept {
+        const BitRow bit = grid_bitboard::column_bit(column);
+        const bool was_filled = (filled[row] & bit) != 0;
+        filled[row] &= ~bit;
+        moving[row] &= ~bit;
+        if (status == CellStatus::FILLED) filled[row] |= bit;
+        if (status == CellStatus::MOVING) moving[row] |= bit;
+
+        if (status == CellStatus::FILLED) {
+            if (row < surface[column]) surface[column] = static_cast<std::int8_t>(row);
+        } else if (was_filled && row == surface[column]) {
+            rescan_surface(column, row + 1);
+        }
+    }
+
+    /**
+     * 1 セルの状態を差し替えた盤面を返す
+     * @pre contains(column, row)
+     */
+    [[nodiscard]] constexpr GridBitboard with_cell(int column, int row,
+                                                   CellStatus status) const noexcept {
+        GridBitboard next = *this;
+        next.assign(column, row, status);
+        return next;
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<GridBitboard>);
+static_assert(GridBitboard::empty(10, 20).is_blocked(-1, 0));
+static_assert(GridBitboard::empty(10, 20).is_blocked(10, 0));
+static_assert(GridBitboard::empty(10, 20).is_blocked(0, 20));
+static_assert(GridBitboard::empty(10, 20).is_blocked(0, -1));
+static_assert(!GridBitboard::empty(10, 20).is_blocked(9, 19));
+static_assert(GridBitboard::empty(10, 20).with_cell(3, 5, CellStatus::FILLED).is_filled(3, 5));
+static_assert(GridBitboard::empty(10, 20).with_cell(3, 5, CellStatus::MOVING).is_blocked(3, 5));
+static_assert(!GridBitboard::empty(10, 20).with_cell(3, 5, CellStatus::MOVING).is_filled(3, 5));
+static_assert(!GridBitboard::empty(10, 20).overlaps({0b1111, 0, 0, 0}, 6, 19));
+static_assert(GridBitboard::empty(10, 20).overlaps({0b1111, 0, 0, 0}, 7, 19));
+static_assert(GridBitboard::empty(10, 20).overlaps({0, 0b0001, 0, 0}, 0, 19));
+static_assert(GridBitboard::empty(10, 20).surface[0] == 20);
+static_assert(GridBitboard::empty(10, 20).with_cell(3, 12, CellStatus::FILLED).surface[3] == 12);
+static_assert(GridBitboard::empty(10, 20)
+                  .with_cell(3, 15, CellStatus::FILLED)
+                  .with_cell(3, 12, CellStatus::FILLED)
+                  .with_cell(3, 12, CellStatus::EMPTY)
+                  .surface[3] == 15);
+// 横向き I（枠の 2 行目）を空の盤面の最上段から落とすと床の上（行 19）まで 18 行
+static_assert(GridBitboard::empty(10, 20).drop_distance({1, 1, 1, 1}, {0, 0b1111, 0, 0}, 0, 0) ==
+              18);
+
+#endif /* C1E0B7A4_3F2D_4A8E_9B61_5D7E2C94A0F3 */
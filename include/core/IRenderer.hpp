@@ -2,12 +2,20 @@
 #define B8AC84C6_6A5A_4990_8095_F03C1115A0EC
 #include <core/Position.hpp>
 #include <core/graphics_types.hpp>  // 先ほどのプリミティブ
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <tl/expected.hpp>
 
 using TextureId = std::uint32_t;
 using FontId = std::uint32_t;
 
+/// 色付きの矩形（fill_rects の 1 要素）
+struct ColoredRect {
+    Rect rect;
+    Color color;
+};
+
 /**
  * IRenderer ― レンダリングのインターフェース
  * 描画処理を抽象化するインターフェースで、具体的なレンダリングバックエンドに依存しない。
@@ -22,6 +30,15 @@ class IRenderer {
     virtual void begin_frame() = 0;
     virtual void end_frame() = 0;
 
+    /**
+     * end_frame() の Present を垂直同期で待つか切り替える
+     * @return 切り替えられたら true（未対応のバックエンドは false）
+     */
+    virtual bool set_vsync(bool enabled) {
+        (void)enabled;
+        return false;
+    }
+
     // 画面クリア
     virtual void clear(Color color = {0, 0, 0, 255}) = 0;
 
@@ -30,10 +47,58 @@ class IRenderer {
     virtual void stroke_rect(const Rect&, Color) = 0;
     virtual void draw_line(Position start, Position end, Color color) = 0;
 
+    /**
+     * 矩形をまとめて塗りつぶす（配列の順に描く。後の要素が上になる）
+     *   - 既定実装は fill_rect を count 回呼ぶ。バックエンドは 1 回の描画呼び出しにまとめてよい
+     */
+    virtual void fill_rects(const ColoredRect* rects, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) this->fill_rect(rects[i].rect, rects[i].color);
+    }
+
+    /**
+     * 同じ色の枠線をまとめて描く
+     *   - 既定実装は stroke_rect を count 回呼ぶ
+     */
+    virtual void stroke_rects(const Rect* rects, std::size_t count, Color color) {
+        for (std::size_t i = 0; i < count; ++i) this->stroke_rect(rects[i], color);
+    }
+
     // 他にも draw_texture, draw_text など必要に応じて追加
     virtual void draw_texture(TextureId id, const Rect& src_region, const Rect& dst_region,
                               double angle = 0.0) = 0;
 
+    // ──────────── オフスクリーン描画 ------------------------------------------
+    /**
+     * 描画先にできるテクスチャを作る（draw_texture で画面に合成できる）
+     *   - 中身は未定義。作った直後とデバイスリセット後は呼び出し側で描き直すこと
+     * @return 成功: TextureId, 失敗: 未対応などのエラーメッセージ
+     */
+    [[nodiscard]]
+    virtual tl::expected<TextureId, std::string> create_render_target(int width, int height) {
+        (void)width;
+        (void)height;
+        return tl::unexpected<std::string>{"create_render_target: not supported"};
+    }
+
+    /**
+     * 以降の描画先を切り替える
+     * @param target 描画先テクスチャ。std::nullopt で画面に戻す
+     * @return 切り替えられたら true
+     */
+    virtual bool set_render_target(std::optional<TextureId> target) { return !target; }
+
+    /// テクスチャを解放する（未登録の ID は無視）
+    virtual void release_texture(TextureId id) { (void)id; }
+
+    /**
+     * 画像ファイルをテクスチャとして読み込む
+     * @return 成功: TextureId, 失敗: 未対応・読み込み失敗のエラーメッセージ
+     */
+    [[nodiscard]]
+    virtual tl::expected<TextureId, std::string> load_texture(const std::string& path) {
+        return tl::unexpected<std::string>{"load_texture: not supported: " + path};
+    }
+
     // ──────────── フォント関連 ------------------------------------------------
     /**
      * フォントをロードして登録
@@ -45,6 +110,9 @@ class IRenderer {
     virtual tl::expected<FontId, std::string> register_font(const std::string& path,
                                                             int pt_size) = 0;
 
+    /// フォントを閉じる（未登録の ID は無視）。同じフォントの再利用は ResourceManager に任せる
+    virtual void release_font(FontId id) { (void)id; }
+
     /**
      * テキストを即描画
      *   - キャッシュが必要なら呼び出し側で wrap してください
@@ -1,12 +1,27 @@
 #ifndef AF4443E9_E719_459C_BC56_81BE22CBDE47
 #define AF4443E9_E719_459C_BC56_81BE22CBDE47
+#include <cstddef>
+#include <cstdint>
 #include <string>
-#include <unordered_map>
+#include <type_traits>
 
 /**
  * 抽象キー入力を表現するenum
  */
-enum class InputKey { UP, DOWN, LEFT, RIGHT, ROTATE_LEFT, ROTATE_RIGHT, DROP, PAUSE, QUIT };
+enum class InputKey : std::uint8_t {
+    UP,
+    DOWN,
+    LEFT,
+    RIGHT,
+    ROTATE_LEFT,
+    ROTATE_RIGHT,
+    DROP,
+    PAUSE,
+    QUIT
+};
+
+/// InputKey の個数
+constexpr std::size_t kInputKeyCount = static_cast<std::size_t>(InputKey::QUIT) + 1;
 
 /**
  * キー入力の状態を表現する構造体
@@ -22,39 +37,104 @@ struct InputState {
 
 /**
  * 入力状態を表現する構造体
- * - key_states: 各キーの状態を保持するマップ
- * - clear_frame_state: フレーム状態をクリアした新インスタンスを返す
+ * - pressed / released / held: InputKey をビット位置とするビット集合
+ * - 自明にコピー可能な 6 バイトの値。毎フレーム値渡しで受け渡し、ヒープ確保をしない
+ * - clear_frame_state: フレーム状態（押した瞬間・離した瞬間）をクリアした値を返す
  * - to_string: 入力状態を文字列に変換する
  */
 struct Input {
-    std::unordered_map<InputKey, InputState> key_states;
-
-    // フレーム状態をクリアした新インスタンスを返す
-    [[nodiscard]] std::shared_ptr<const Input> clear_frame_state() const {
-        auto next = std::make_shared<Input>(*this);
-        for (auto& [_, state] : next->key_states) {
-            state.is_pressed = false;
-            state.is_released = false;
-        }
-        return next;
+    using KeyBits = std::uint16_t;
+
+    KeyBits pressed = 0;
+    KeyBits released = 0;
+    KeyBits held = 0;
+
+    static constexpr KeyBits bit_of(InputKey key) noexcept {
+        return static_cast<KeyBits>(1u << static_cast<unsigned>(key));
+    }
+
+    constexpr bool is_pressed(InputKey key) const noexcept { return (pressed & bit_of(key)) != 0; }
+    constexpr bool is_released(InputKey key) const noexcept {
+        return (released & bit_of(key)) != 0;
+    }
+    constexpr bool is_held(InputKey key) const noexcept { return (held & bit_of(key)) != 0; }
+
+    constexpr InputState state_of(InputKey key) const noexcept {
+        return InputState{is_pressed(key), is_released(key), is_held(key)};
+    }
+
+    /// キーが押された（押しっぱなしのリピートは押した瞬間として数えない）
+    constexpr void key_down(InputKey key) noexcept {
+        if (!is_held(key)) pressed |= bit_of(key);
+        held |= bit_of(key);
+    }
+
+    /// キーが離された
+    constexpr void key_up(InputKey key) noexcept {
+        held &= static_cast<KeyBits>(~bit_of(key));
+        released |= bit_of(key);
+    }
+
+    // フレーム状態をクリアした新しい値を返す
+    [[nodiscard]] constexpr Input clear_frame_state() const noexcept { return Input{0, 0, held}; }
+
+    /**
+     * まだロジックに渡していない入力に、新しいフレームの入力を重ねる
+     *   - pressed / released は和を取り、どのティックにも渡らずに消えることを防ぐ
+     *   - held は新しいフレームの値
+     */
+    [[nodiscard]] constexpr Input accumulate(const Input& newer) const noexcept {
+        return Input{static_cast<KeyBits>(pressed | newer.pressed),
+                     static_cast<KeyBits>(released | newer.released), newer.held};
     }
 
     std::string to_string() const {
         std::string result;
-        for (const auto& [key, state] : key_states) {
-            result += "Key: " + std::to_string(static_cast<int>(key)) +
-                      ", Pressed: " + std::to_string(state.is_pressed) +
-                      ", Released: " + std::to_string(state.is_released) +
-                      ", Held: " + std::to_string(state.is_held) + "\n";
+        for (std::size_t i = 0; i < kInputKeyCount; ++i) {
+            const InputState state = state_of(static_cast<InputKey>(i));
+            if (!state.is_pressed && !state.is_released && !state.is_held) continue;
+            result += "Key: " + std::to_string(i) + ", Pressed: " +
+                      std::to_string(state.is_pressed) + ", Released: " +
+                      std::to_string(state.is_released) + ", Held: " +
+                      std::to_string(state.is_held) + "\n";
         }
         return result;
     }
 };
 
+static_assert(std::is_trivially_copyable_v<Input>);
+static_assert(kInputKeyCount <= sizeof(Input::KeyBits) * 8);
+
+namespace input_checks {
+// 押した瞬間 → 次フレームは押しっぱなしのみ → 離した瞬間
+constexpr Input pressed_once() noexcept {
+    Input input;
+    input.key_down(InputKey::LEFT);
+    input.key_down(InputKey::LEFT);  // OS のキーリピート
+    return input;
+}
+constexpr Input released_next_frame() noexcept {
+    Input input = pressed_once().clear_frame_state();
+    input.key_up(InputKey::LEFT);
+    return input;
+}
+}  // namespace input_checks
+
+static_assert(input_checks::pressed_once().is_pressed(InputKey::LEFT) &&
+              input_checks::pressed_once().is_held(InputKey::LEFT));
+static_assert(!input_checks::pressed_once().clear_frame_state().is_pressed(InputKey::LEFT) &&
+              input_checks::pressed_once().clear_frame_state().is_held(InputKey::LEFT));
+static_assert(input_checks::released_next_frame().is_released(InputKey::LEFT) &&
+              !input_checks::released_next_frame().is_held(InputKey::LEFT));
+
 class InputPoller {
    public:
     virtual ~InputPoller() = default;
-    virtual std::shared_ptr<const Input> poll(std::shared_ptr<const Input> previous_input) = 0;
+    /**
+     * 前フレームの入力を引き継いで今フレームの入力を返す
+     * @param previous_input 前フレームの入力（held を引き継ぐ）
+     */
+    virtual Input poll(const Input& previous_input) = 0;
 };
 
 #endif /* AF4443E9_E719_459C_BC56_81BE22CBDE47 */
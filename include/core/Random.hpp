@@ -0,0 +1,73 @@
+#ifndef D4C8A2E7_6F1B_4E93_A05D_8B2E7C1F4A36
+#define D4C8A2E7_6F1B_4E93_A05D_8B2E7C1F4A36
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+// ────────────────── 再現可能な疑似乱数 ──────────────────
+// 標準ライブラリの分布クラスや std::rand は実装ごとに結果が異なるため、
+// ネイティブと WASM で同じ列が必要な箇所（テトリミノの出現順など）はこちらを使う。
+namespace rng {
+
+/// SplitMix64。1 つの 64bit シードから xoshiro の状態を作るのに使う
+constexpr std::uint64_t splitmix64(std::uint64_t& state) noexcept {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+constexpr std::uint32_t rotl(std::uint32_t x, int k) noexcept { return (x << k) | (x >> (32 - k)); }
+
+/**
+ * Xoshiro128** ― 状態 16 バイトの 32bit 疑似乱数生成器
+ *   - 32bit 演算だけで完結するので wasm32 でも速く、結果も全環境で一致する
+ *   - UniformRandomBitGenerator を満たす
+ */
+class Xoshiro128StarStar {
+   public:
+    using result_type = std::uint32_t;
+
+    constexpr explicit Xoshiro128StarStar(std::uint64_t seed) noexcept : state_{} {
+        std::uint64_t sm = seed;
+        const std::uint64_t a = splitmix64(sm);
+        const std::uint64_t b = splitmix64(sm);
+        state_ = {static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(a >> 32),
+                  static_cast<std::uint32_t>(b), static_cast<std::uint32_t>(b >> 32)};
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()() noexcept {
+        const std::uint32_t result = rotl(state_[1] * 5, 7) * 9;
+        const std::uint32_t t = state_[1] << 9;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 11);
+        return result;
+    }
+
+    /**
+     * [0, bound) の一様な整数（剰余の偏りは棄却法で除く）
+     * @pre bound > 0
+     */
+    constexpr std::uint32_t next_below(std::uint32_t bound) noexcept {
+        const std::uint32_t threshold = (0u - bound) % bound;  // 2^32 mod bound
+        for (;;) {
+            const std::uint32_t r = (*this)();
+            if (r >= threshold) return r % bound;
+        }
+    }
+
+   private:
+    std::array<std::uint32_t, 4> state_;
+};
+
+}  // namespace rng
+
+#endif /* D4C8A2E7_6F1B_4E93_A05D_8B2E7C1F4A36 */
@@ -0,0 +1,74 @@
+#ifndef C3A9E6F2_8B14_4D07_9C5E_1F7A4B2D8E63
+#define C3A9E6F2_8B14_4D07_9C5E_1F7A4B2D8E63
+
+#include <core/IRenderer.hpp>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <tl/expected.hpp>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * ResourceManager ― フォント・テクスチャの重複ロードを防ぐ参照カウント付きの管理
+ *   - フォントは (パス, ポイントサイズ)、テクスチャはパスをキーに、1 回だけレンダラに読み込む
+ *   - acquire_* で参照を 1 つ増やし、同じキーなら同じ ID を返す。release_* で減らし、
+ *     0 になったらレンダラから解放する
+ *   - シーンは initialize(config, resources) で acquire し（先読み）、cleanup で release する。
+ *     render では取得済みの ID を使うだけにして、毎フレームのロードをしない
+ *   - レンダラより先に破棄すること（破棄時には解放しない。残りはレンダラの破棄で閉じられる）
+ */
+class ResourceManager {
+   public:
+    explicit ResourceManager(IRenderer& renderer) noexcept : renderer_(renderer) {}
+
+    ResourceManager(const ResourceManager&) = delete;
+    ResourceManager& operator=(const ResourceManager&) = delete;
+
+    /**
+     * フォントを取得する（未ロードならロードする）
+     * @return 成功: FontId, 失敗: レンダラのエラーメッセージ（参照は増えない）
+     */
+    [[nodiscard]] tl::expected<FontId, std::string> acquire_font(const std::string& path,
+                                                                 int pt_size);
+
+    /// フォントの参照を 1 つ返す（未知の ID は無視）
+    void release_font(FontId id);
+
+    /**
+     * テクスチャを取得する（未ロードならロードする）
+     * @return 成功: TextureId, 失敗: レンダラのエラーメッセージ（参照は増えない）
+     */
+    [[nodiscard]] tl::expected<TextureId, std::string> acquire_texture(const std::string& path);
+
+    /// テクスチャの参照を 1 つ返す（未知の ID は無視）
+    void release_texture(TextureId id);
+
+    /// 保持中のフォント・テクスチャの数
+    [[nodiscard]] std::size_t font_count() const noexcept { return fonts_.size(); }
+    [[nodiscard]] std::size_t texture_count() const noexcept { return textures_.size(); }
+
+    /// レンダラに実際に読み込ませた回数（重複排除の確認用）
+    [[nodiscard]] std::size_t load_count() const noexcept { return loads_; }
+
+    /// 参照数（保持していなければ 0）
+    [[nodiscard]] int font_references(FontId id) const noexcept;
+
+   private:
+    using FontKey = std::pair<std::string, int>;
+
+    template <typename Id>
+    struct Entry {
+        Id id;
+        int references;
+    };
+
+    IRenderer& renderer_;
+    std::map<FontKey, Entry<FontId>> fonts_;
+    std::unordered_map<FontId, FontKey> font_keys_;
+    std::map<std::string, Entry<TextureId>> textures_;
+    std::unordered_map<TextureId, std::string> texture_keys_;
+    std::size_t loads_ = 0;
+};
+
+#endif /* C3A9E6F2_8B14_4D07_9C5E_1F7A4B2D8E63 */
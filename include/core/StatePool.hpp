@@ -0,0 +1,100 @@
+#ifndef A1C6E3F8_5D29_4B74_9F0A_8E2B7D4C1A65
+#define A1C6E3F8_5D29_4B74_9F0A_8E2B7D4C1A65
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/**
+ * StatePool ― イミュータブルなゲーム状態を毎フレーム作り直すための、ブロックの再利用プール
+ *   - 16 バイト刻みの大きさごとに空きブロックの連結リストを持つ。返されたブロックは
+ *     ヒープに返さず、次に同じ大きさを求められたときに使い回す
+ *   - 定常状態（前のフレームの状態を捨てて同じ型の状態を 1 つ作る）ではヒープ確保が起きない
+ *   - 256 バイトを超える大きさはそのまま ::operator new に任せる
+ *   - シーン 1 つにつき 1 個。スレッドセーフではない（シーンを更新するスレッドだけで使う）
+ *   - 寿命は PoolAllocator が shared_ptr で延ばすので、シーンより長生きする状態があってもよい
+ */
+class StatePool {
+   public:
+    static constexpr std::size_t kGranularity = alignof(std::max_align_t);
+    static constexpr std::size_t kClassCount = 16;  ///< 最大 kGranularity × 16 バイトまで再利用する
+
+    StatePool() = default;
+    StatePool(const StatePool&) = delete;
+    StatePool& operator=(const StatePool&) = delete;
+    ~StatePool();
+
+    /// bytes 以上のブロックを返す（空きがなければヒープから確保する）
+    [[nodiscard]] void* allocate(std::size_t bytes);
+
+    /// allocate で得たブロックを返す（bytes は allocate と同じ値）
+    void deallocate(void* block, std::size_t bytes) noexcept;
+
+    /// ヒープから確保した回数（再利用できなかった回数）
+    [[nodiscard]] std::size_t heap_allocations() const noexcept { return heap_allocations_; }
+    /// 空きブロックを使い回した回数
+    [[nodiscard]] std::size_t reused() const noexcept { return reused_; }
+
+   private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    std::array<FreeBlock*, kClassCount> free_{};
+    std::size_t heap_allocations_ = 0;
+    std::size_t reused_ = 0;
+
+    /// 再利用の対象なら大きさの区分、対象外なら kClassCount
+    [[nodiscard]] static constexpr std::size_t class_of(std::size_t bytes) noexcept {
+        const std::size_t index = (bytes + kGranularity - 1) / kGranularity;
+        return index == 0 || index > kClassCount ? kClassCount : index - 1;
+    }
+};
+
+/**
+ * PoolAllocator ― StatePool から確保するアロケータ（std::allocate_shared 用）
+ *   - プールを shared_ptr で持つので、最後の状態が解放されるまでプールは生きている
+ */
+template <typename T>
+class PoolAllocator {
+   public:
+    using value_type = T;
+
+    explicit PoolAllocator(std::shared_ptr<StatePool> pool) noexcept : pool_(std::move(pool)) {}
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : pool_(other.pool()) {}
+
+    [[nodiscard]] T* allocate(std::size_t n) {
+        static_assert(alignof(T) <= StatePool::kGranularity, "over-aligned types are not pooled");
+        return static_cast<T*>(pool_->allocate(n * sizeof(T)));
+    }
+    void deallocate(T* p, std::size_t n) noexcept { pool_->deallocate(p, n * sizeof(T)); }
+
+    [[nodiscard]] const std::shared_ptr<StatePool>& pool() const noexcept { return pool_; }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept {
+        return pool_ == other.pool();
+    }
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const noexcept {
+        return pool_ != other.pool();
+    }
+
+   private:
+    std::shared_ptr<StatePool> pool_;
+};
+
+/**
+ * 状態をプールから作る（std::make_shared の代わり）
+ *   - pool が空なら std::make_shared と同じ
+ */
+template <typename T, typename... Args>
+[[nodiscard]] std::shared_ptr<T> make_pooled(const std::shared_ptr<StatePool>& pool,
+                                             Args&&... args) {
+    if (!pool) return std::make_shared<T>(std::forward<Args>(args)...);
+    return std::allocate_shared<T>(PoolAllocator<T>(pool), std::forward<Args>(args)...);
+}
+
+#endif /* A1C6E3F8_5D29_4B74_9F0A_8E2B7D4C1A65 */
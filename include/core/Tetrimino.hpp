@@ -57,29 +57,234 @@ constexpr std::array<Shape4, 7> kBaseShapes{
      /* J */ {{{1, 0, 0, 0}, {1, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}}},
      /* L */ {{{0, 0, 1, 0}, {1, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}}}}};
 
-constexpr Shape4 rotate_cw(const Shape4& s) noexcept {
+/// SRS の回転枠サイズ（I: 4x4, O: 2x2, その他: 3x3）。kBaseShapes は枠の左上に詰めて定義している。
+constexpr std::array<std::size_t, 7> kBoxSizes{{4, 2, 3, 3, 3, 3, 3}};
+
+/// n x n の枠内で時計回りに 90 度回転
+constexpr Shape4 rotate_cw(const Shape4& s, std::size_t n) noexcept {
     Shape4 out{};
+    for (std::size_t y = 0; y < n; ++y)
+        for (std::size_t x = 0; x < n; ++x) out[x][n - 1 - y] = s[y][x];
+    return out;
+}
+
+/// 行ごとのビットマスク（bit x = ローカル列 x）。盤面のビットボードとシフト＋AND で照合する。
+using RowMask4 = std::array<std::uint8_t, 4>;
+
+constexpr RowMask4 row_masks(const Shape4& s) noexcept {
+    RowMask4 out{};
     for (std::size_t y = 0; y < 4; ++y)
-        for (std::size_t x = 0; x < 4; ++x) out[x][3 - y] = s[y][x];
+        for (std::size_t x = 0; x < 4; ++x)
+            if (s[y][x]) out[y] = static_cast<std::uint8_t>(out[y] | (1u << x));
     return out;
 }
 
-/// 回転を都度計算（LUT 不使用）
-inline Shape4 shape_of(TetriminoType type, Rotation r) noexcept {
-    Shape4 s = kBaseShapes[static_cast<std::size_t>(type)];
-    switch (r) {
-        case Rotation::R0:
-            return s;
-        case Rotation::R90:
-            return rotate_cw(s);
-        case Rotation::R180:
-            return rotate_cw(rotate_cw(s));
-        case Rotation::R270:
-            return rotate_cw(rotate_cw(rotate_cw(s)));
+/// 4x4 枠内で実際にセルがある範囲（両端を含む）
+struct ShapeBounds {
+    int min_column;
+    int min_row;
+    int max_column;
+    int max_row;
+};
+
+/// 枠内の列ごとの最下段セルの行（セルのない列は -1）。落下距離の計算に使う。
+using BottomProfile = std::array<std::int8_t, 4>;
+
+/**
+ * ShapeData ― 種類 x 回転ごとの前計算済み形状
+ *   - shape: 4x4 のブール配列
+ *   - rows: 行ビットマスク（衝突判定用）
+ *   - cells: 4 セルの枠内オフセット {column, row}（行優先順）
+ *   - bounds: バウンディングボックス
+ *   - bottom: 列ごとの最下段（落下距離用）
+ */
+struct ShapeData {
+    Shape4 shape;
+    RowMask4 rows;
+    std::array<GridColumnRow, 4> cells;
+    ShapeBounds bounds;
+    BottomProfile bottom;
+};
+
+constexpr ShapeData make_shape_data(const Shape4& shape) noexcept {
+    ShapeData data{shape, row_masks(shape), {}, {4, 4, -1, -1}, {-1, -1, -1, -1}};
+    std::size_t n = 0;
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            if (!shape[y][x]) continue;
+            if (n < data.cells.size()) data.cells[n] = GridColumnRow{x, y};
+            ++n;
+            if (x < data.bounds.min_column) data.bounds.min_column = x;
+            if (y < data.bounds.min_row) data.bounds.min_row = y;
+            if (x > data.bounds.max_column) data.bounds.max_column = x;
+            if (y > data.bounds.max_row) data.bounds.max_row = y;
+            data.bottom[x] = static_cast<std::int8_t>(y);  // 行優先で走査するので最後が最下段
+        }
     }
-    return s;  // 対応外 → R0
+    return data;
 }
 
+using ShapeTable = std::array<std::array<ShapeData, 4>, 7>;
+
+/// kBaseShapes を SRS の枠サイズで回転させ、7 種 x 4 回転を前計算する
+constexpr ShapeTable make_shape_table() noexcept {
+    ShapeTable table{};
+    for (std::size_t t = 0; t < table.size(); ++t) {
+        Shape4 s = kBaseShapes[t];
+        for (std::size_t r = 0; r < 4; ++r) {
+            table[t][r] = make_shape_data(s);
+            s = rotate_cw(s, kBoxSizes[t]);
+        }
+    }
+    return table;
+}
+
+/// 7 種 x 4 回転の形状テーブル（コンパイル時生成）
+constexpr ShapeTable kShapeTable = make_shape_table();
+
+constexpr const ShapeData& shape_data_of(TetriminoType type, Rotation r) noexcept {
+    return kShapeTable[static_cast<std::size_t>(type)][static_cast<std::size_t>(r)];
+}
+
+/// 回転済み形状（テーブル参照のみ）
+constexpr const Shape4& shape_of(TetriminoType type, Rotation r) noexcept {
+    return shape_data_of(type, r).shape;
+}
+
+constexpr const RowMask4& row_masks_of(TetriminoType type, Rotation r) noexcept {
+    return shape_data_of(type, r).rows;
+}
+
+constexpr bool all_shapes_have_four_cells() noexcept {
+    for (const auto& per_type : kShapeTable) {
+        for (const auto& data : per_type) {
+            int count = 0;
+            for (auto row : data.rows)
+                for (int x = 0; x < 4; ++x) count += (row >> x) & 1;
+            if (count != 4) return false;
+        }
+    }
+    return true;
+}
+
+static_assert(all_shapes_have_four_cells());
+// O は回転しても動かない
+static_assert(row_masks_of(TetriminoType::O, Rotation::R90)[0] == 0b0011 &&
+              row_masks_of(TetriminoType::O, Rotation::R270)[1] == 0b0011);
+// I は 4x4 枠内で 2 行目 → 3 列目 → 3 行目 → 2 列目 と回る
+static_assert(row_masks_of(TetriminoType::I, Rotation::R90)[0] == 0b0100 &&
+              row_masks_of(TetriminoType::I, Rotation::R180)[2] == 0b1111 &&
+              row_masks_of(TetriminoType::I, Rotation::R270)[3] == 0b0010);
+// T は 3x3 枠内で回る
+static_assert(row_masks_of(TetriminoType::T, Rotation::R0)[0] == 0b0010 &&
+              row_masks_of(TetriminoType::T, Rotation::R0)[1] == 0b0111 &&
+              row_masks_of(TetriminoType::T, Rotation::R90)[1] == 0b0110);
+static_assert(shape_data_of(TetriminoType::T, Rotation::R90).bounds.min_column == 1 &&
+              shape_data_of(TetriminoType::T, Rotation::R90).bounds.max_row == 2);
+static_assert(shape_data_of(TetriminoType::L, Rotation::R180).cells[3].column == 0 &&
+              shape_data_of(TetriminoType::L, Rotation::R180).cells[3].row == 2);
+// T の R0 は中央列だけ 1 段低い（凸の向き）。R180 は全列が 1 段目、中央だけ 2 段目
+static_assert(shape_data_of(TetriminoType::T, Rotation::R0).bottom[0] == 1 &&
+              shape_data_of(TetriminoType::T, Rotation::R0).bottom[1] == 1 &&
+              shape_data_of(TetriminoType::T, Rotation::R0).bottom[3] == -1);
+static_assert(shape_data_of(TetriminoType::T, Rotation::R180).bottom[0] == 1 &&
+              shape_data_of(TetriminoType::T, Rotation::R180).bottom[1] == 2);
+
+// ────────────────── SRS ウォールキック ──────────────────
+
+/// 回転方向
+enum class RotationDirection : std::uint8_t { CW, CCW };
+
+/// 1 回の回転で試すキックの候補数
+constexpr std::size_t kKickTests = 5;
+using KickTests = std::array<GridColumnRow, kKickTests>;
+/// [回転状態][候補] のオフセットデータ（SRS 仕様どおり y は上向き正）
+using SrsOffsets = std::array<KickTests, 4>;
+
+constexpr SrsOffsets kJlstzOffsets{{{{{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}}},
+                                    {{{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}}},
+                                    {{{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}}},
+                                    {{{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}}}}};
+constexpr SrsOffsets kIOffsets{{{{{0, 0}, {-1, 0}, {2, 0}, {-1, 0}, {2, 0}}},
+                                {{{-1, 0}, {0, 0}, {0, 0}, {0, 1}, {0, -2}}},
+                                {{{-1, 1}, {1, 1}, {-2, 1}, {1, 0}, {-2, 0}}},
+                                {{{0, 1}, {0, 1}, {0, 1}, {0, -1}, {0, 2}}}}};
+/// O は 2x2 枠で回すので移動が生じない
+constexpr SrsOffsets kOOffsets{};
+
+/**
+ * オフセットデータからキック候補を生成する
+ *   - キック = offset[from] - offset[to]
+ *   - 枠内回転との差（先頭候補の差分）を差し引き、先頭候補を (0, 0) にそろえる
+ *   - y は盤面座標（下向き正）に反転する
+ */
+constexpr KickTests make_kicks(const SrsOffsets& offsets, std::size_t from,
+                               std::size_t to) noexcept {
+    KickTests kicks{};
+    const int base_x = offsets[from][0].column - offsets[to][0].column;
+    const int base_y = offsets[from][0].row - offsets[to][0].row;
+    for (std::size_t i = 0; i < kKickTests; ++i) {
+        const int x = offsets[from][i].column - offsets[to][i].column - base_x;
+        const int y = offsets[from][i].row - offsets[to][i].row - base_y;
+        kicks[i] = GridColumnRow{x, -y};
+    }
+    return kicks;
+}
+
+/// [種類][回転前の状態][回転方向]
+using KickTable = std::array<std::array<std::array<KickTests, 2>, 4>, 7>;
+
+constexpr KickTable make_kick_table() noexcept {
+    KickTable table{};
+    for (std::size_t t = 0; t < table.size(); ++t) {
+        const auto type = static_cast<TetriminoType>(t);
+        const SrsOffsets& offsets = type == TetriminoType::I   ? kIOffsets
+                                    : type == TetriminoType::O ? kOOffsets
+                                                               : kJlstzOffsets;
+        for (std::size_t from = 0; from < 4; ++from) {
+            table[t][from][0] = make_kicks(offsets, from, (from + 1) & 3);
+            table[t][from][1] = make_kicks(offsets, from, (from + 3) & 3);
+        }
+    }
+    return table;
+}
+
+/// SRS ウォールキックテーブル（コンパイル時生成）
+constexpr KickTable kWallKicks = make_kick_table();
+
+constexpr const KickTests& wall_kicks_of(TetriminoType type, Rotation from,
+                                         RotationDirection dir) noexcept {
+    return kWallKicks[static_cast<std::size_t>(type)][static_cast<std::size_t>(from)]
+                     [static_cast<std::size_t>(dir)];
+}
+
+/// SRS ガイドラインの表（y 上向き, {x0, y0, x1, y1, ...}）と生成結果を照合
+constexpr bool kicks_match_guideline(TetriminoType type, Rotation from, RotationDirection dir,
+                                     const std::array<int, kKickTests * 2>& expected) noexcept {
+    const KickTests& kicks = wall_kicks_of(type, from, dir);
+    for (std::size_t i = 0; i < kKickTests; ++i) {
+        if (kicks[i].column != expected[i * 2] || kicks[i].row != -expected[i * 2 + 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(kicks_match_guideline(TetriminoType::T, Rotation::R0, RotationDirection::CW,
+                                    {0, 0, -1, 0, -1, 1, 0, -2, -1, -2}));
+static_assert(kicks_match_guideline(TetriminoType::J, Rotation::R270, RotationDirection::CW,
+                                    {0, 0, -1, 0, -1, -1, 0, 2, -1, 2}));
+static_assert(kicks_match_guideline(TetriminoType::S, Rotation::R180, RotationDirection::CCW,
+                                    {0, 0, -1, 0, -1, 1, 0, -2, -1, -2}));
+static_assert(kicks_match_guideline(TetriminoType::I, Rotation::R0, RotationDirection::CW,
+                                    {0, 0, -2, 0, 1, 0, -2, -1, 1, 2}));
+static_assert(kicks_match_guideline(TetriminoType::I, Rotation::R0, RotationDirection::CCW,
+                                    {0, 0, -1, 0, 2, 0, -1, 2, 2, -1}));
+static_assert(kicks_match_guideline(TetriminoType::I, Rotation::R180, RotationDirection::CW,
+                                    {0, 0, 2, 0, -1, 0, 2, 1, -1, -2}));
+static_assert(kicks_match_guideline(TetriminoType::O, Rotation::R90, RotationDirection::CCW,
+                                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0}));
+
 constexpr std::uint32_t kDefaultLockDelayMs = 50;
 
 }  // namespace tetrimino
@@ -96,6 +301,11 @@ struct Tetrimino {
 // ────────────────── 操作ユーティリティ ──────────────────
 namespace tetrimino {
 
+/// 4x4 枠の左上が乗っているグリッド上の列・行
+[[nodiscard]] inline GridColumnRow origin_of(const Tetrimino& src) noexcept {
+    return {static_cast<int>(src.pos.x), static_cast<int>(src.pos.y)};
+}
+
 [[nodiscard]] inline Tetrimino make(Position p, TetriminoType t,
                                     TetriminoStateType st = TetriminoStateType::ACTIVE) noexcept {
     return {p, t, Rotation::R0, st, 0};
@@ -113,6 +323,14 @@ namespace tetrimino {
     out.rot = static_cast<Rotation>((static_cast<std::uint8_t>(src.rot) + 1) & 3);
     return out;
 }
+[[nodiscard]] inline Tetrimino rotate_ccw(const Tetrimino& src) noexcept {
+    auto out = src;
+    out.rot = static_cast<Rotation>((static_cast<std::uint8_t>(src.rot) + 3) & 3);
+    return out;
+}
+[[nodiscard]] inline Tetrimino rotate(const Tetrimino& src, RotationDirection dir) noexcept {
+    return dir == RotationDirection::CW ? rotate_cw(src) : rotate_ccw(src);
+}
 [[nodiscard]] inline Tetrimino add_lock_elapsed(const Tetrimino& src, std::uint32_t dt) noexcept {
     if (src.state != TetriminoStateType::PENDING) return src;
     auto out = src;
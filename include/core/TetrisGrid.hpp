@@ -2,95 +2,234 @@
 #define EAEC85BA_F694_47C7_AB0E_2FD093BD0A16
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <core/BoardMemoryPolicy.hpp>
 #include <core/Cell.hpp>
+#include <core/GameConfig.hpp>
+#include <core/GridBitboard.hpp>
 #include <core/IRenderer.hpp>
 #include <core/Position.hpp>
 #include <core/Tetrimino.hpp>
 #include <core/graphics_types.hpp>
-#include <immer/vector.hpp>
+#include <immer/flex_vector.hpp>
+#include <optional>
 #include <string>
 #include <tl/expected.hpp>
 
 /**
- * TetrisGrid ― テトリスの盤面を表す値オブジェクト
+ * MoveAvailability ― 1 入力ティック分の移動可否
+ * TetrisGrid::probe_moves() がまとめて判定して返す
+ */
+struct MoveAvailability {
+    bool left;
+    bool right;
+    bool down;
+    bool rotate_cw;  ///< SRS のウォールキック込み
+};
+
+template <typename MemoryPolicy>
+struct BasicRowClearResult;
+
+/**
+ * CellUpdate ― セル 1 つ分の更新要求
+ * TetrisGrid::update_cells() にまとめて渡す
+ */
+struct CellUpdate {
+    GridColumnRow position;
+    CellStatus status;
+    Color color;
+};
+
+/**
+ * BasicTetrisGrid ― テトリスの盤面を表す値オブジェクト
  *   - 生成は static create() からのみ許可
  *   - 不変オブジェクトとみなし setter は用意しない
+ *   - セルは状態＋パレット番号の 1 バイト（PackedCell）だけで持つ。盤面に書く色は
+ *     tetrimino::color_of 由来で必ずパレットに収まるので、座標付きの Cell を別の保存形式として
+ *     残さない（2 形式を持つと判定・描画・行消去の経路がすべて二重になる）
+ *   - MemoryPolicy は行を持つ flex_vector の immer メモリポリシー（board_memory 参照）。
+ *     通常は TetrisGrid（スレッド間で共有できる既定のポリシー）を使う
  */
-class TetrisGrid {
+template <typename MemoryPolicy>
+class BasicTetrisGrid {
    public:
+    /// 1 行分のセル（1 セル 1 バイト、列数の上限まで固定長。盤面の列数より右は未使用）
+    using PackedRow = std::array<PackedCell, grid_bitboard::kMaxColumns>;
+    /// 行の列。行単位の削除・挿入で行ノードを共有できるよう外側は flex_vector
+    using CellRows = immer::flex_vector<PackedRow, MemoryPolicy>;
+
     // 読み取り専用でpublicにしておく
     const std::string id;
-    const Position position;                         ///< グリッドの左上位置
-    const Size size;                                 ///< 全体サイズ
-    const GridColumnRow grid_size;                   ///< 行数・列数
-    const immer::vector<immer::vector<Cell>> cells;  // ← 変更点
-    const CellFactory cell_factory;                  ///< セル生成用ファクトリ
+    const Position position;        ///< グリッドの左上位置
+    const Size size;                ///< 全体サイズ
+    const GridColumnRow grid_size;  ///< 行数・列数
+    const CellRows cells;  ///< 状態と色だけを持つセル。座標・サイズは cell_at() で都度求める
+    const CellFactory cell_factory;  ///< セル生成用ファクトリ
+    const GridBitboard occupancy;  ///< cells と同期した占有ビットボード（判定系はこちらを参照）
 
     /**
-     * コンストラクタ
+     * 全セル EMPTY のグリッドを設定から生成する
      * @param id グリッドの識別子
-     * @param position グリッドの左上位置
-     * @param size グリッドのサイズ
-     * @param grid_size 行数・列数
-     * @param cell_factory セル生成用ファクトリ
+     * @param config ゲーム設定（位置・セルサイズ・行数・列数）
+     * @return 成功時はグリッド、行数・列数がビットボードの上限を超える場合はエラーメッセージ
      */
-    TetrisGrid(std::string id, Position position, Size size, GridColumnRow grid_size,
-               CellFactory factory, immer::vector<immer::vector<Cell>> cells)
-        : id(std::move(id)),
-          position(position),
-          size(size),
-          grid_size(grid_size),
-          cells(std::move(cells)),
-          cell_factory(std::move(factory)) {}
-
-    inline void render(IRenderer& renderer) {
-        // セルを描画する
-        int columns = this->grid_size.column;
-        int rows = this->grid_size.row;
-
-        for (int row = 0; row < rows; ++row) {
-            for (int column = 0; column < columns; ++column) {
-                const Cell& cell = this->cells[row][column];
-                cell.render(renderer);
-            }
-        }
+    [[nodiscard]] static tl::expected<BasicTetrisGrid, std::string> create(
+        std::string id, const GameConfig& config);
+
+    /// 行の集合（bit r が r 行目）。kMaxRows 行がちょうど収まる
+    using RowMask = std::uint32_t;
+    static_assert(grid_bitboard::kMaxRows <= 32, "RowMask に全行が収まること");
+
+    /**
+     * 盤面を描画する
+     *   - FILLED のセルは fill_rects、それ以外の枠線は stroke_rects にまとめ、描画呼び出しは 2 回
+     *   - 見た目はセルごとの Cell::render と同じ（セル同士は重ならないので順序に依存しない）
+     */
+    void render(IRenderer& renderer) const;
+
+    /**
+     * 指定した行だけを、盤面の左上を origin に置いて描画する（BoardRenderCache の部分再描画用）
+     * @param rows 描画する行
+     * @param origin 盤面の左上の描画位置
+     */
+    void render_rows(IRenderer& renderer, RowMask rows, Position origin) const;
+
+    /// 全行の RowMask
+    [[nodiscard]] RowMask all_rows() const noexcept {
+        return this->grid_size.row >= 32 ? ~RowMask{0} : (RowMask{1} << this->grid_size.row) - 1;
     }
 
-    Position get_position_of_cell(const GridColumnRow& grid_position, double cell_size);
+    /**
+     * 行・列のセルを描画用の Cell に展開する
+     *   - 座標は盤面の原点と CellFactory::size から、色はパレットから求める
+     * @pre is_within_bounds(grid_position.column, grid_position.row)
+     */
+    [[nodiscard]] Cell cell_at(const GridColumnRow& grid_position) const;
+
+    Position get_position_of_cell(const GridColumnRow& grid_position, double cell_size) const;
 
-    GridColumnRow get_grid_position_of_cell(const Position& cell_position, double cell_size);
+    GridColumnRow get_grid_position_of_cell(const Position& cell_position, double cell_size) const;
 
-    bool is_within_bounds(int column, int row);
+    bool is_within_bounds(int column, int row) const;
 
-    bool is_within_bounds(const Position& position);
+    bool is_within_bounds(const Position& position) const;
 
     bool is_filled_cell(const GridColumnRow& grid_position) const;
 
     bool is_colliding(const GridColumnRow& before, const GridColumnRow& after) const;
 
-    // 変更点：更新系メソッドは新しいインスタンスを返す
-    [[nodiscard]] TetrisGrid update_cell(const GridColumnRow& pos, CellStatus status,
-                                         Color color) const;
+    /**
+     * テトリミノ全体を現在位置・回転のまま置けるか
+     *   - 行マスクを盤面のビットボードとシフト＋AND で 4 行分照合する
+     *   - FILLED のセルと盤面外が衝突対象（MOVING は操作中ピース自身とみなす）
+     */
+    [[nodiscard]] bool can_place(const Tetrimino& tetrimino) const noexcept;
+
+    /// 左右・下・右回転をまとめて判定する（1 入力ティック 1 呼び出し）
+    [[nodiscard]] MoveAvailability probe_moves(const Tetrimino& tetrimino) const noexcept;
+
+    /**
+     * SRS のウォールキック候補を順に試して回転する
+     * @return 置ける候補があれば回転後のテトリミノ、なければ std::nullopt
+     */
+    [[nodiscard]] std::optional<Tetrimino> try_rotate(
+        const Tetrimino& tetrimino, tetrimino::RotationDirection dir) const noexcept;
+
+    /**
+     * テトリミノを現在位置から何行落とせるか（ハードドロップ・ゴースト表示用）
+     *   - ピースの列ごとの最下段と、盤面が保持する列ごとの最上段 FILLED の差から O(4) で求める
+     *   - 張り出しの下に潜り込んでいる場合だけビットボードを行単位で照合する
+     * @pre can_place(tetrimino)
+     */
+    [[nodiscard]] int drop_distance(const Tetrimino& tetrimino) const noexcept;
+
+    /// drop_distance() 行だけ落とした位置（ゴーストピース・ハードドロップの着地点）
+    [[nodiscard]] Tetrimino landing_position(const Tetrimino& tetrimino) const noexcept;
+
+    /**
+     * セルを 1 つ更新した新しい盤面を返す（update_cells の 1 要素版）
+     *   - EMPTY にするときは色を問わず白で保存する
+     *   - それ以外の色は cell_palette::kColors にあるものだけ保存できる。近い色への丸めはしない
+     * @return 成功時は更新後の盤面、範囲外・不正遷移・パレットにない色はエラーメッセージ
+     */
+    [[nodiscard]] tl::expected<BasicTetrisGrid, std::string> update_cell(const GridColumnRow& pos,
+                                                                         CellStatus status,
+                                                                         Color color) const;
+
+    /**
+     * 複数セルをまとめて更新し、新しい盤面を 1 つだけ生成する
+     *   - 要求は先頭から順に適用する。同じセルへの連続した遷移（EMPTY → MOVING → FILLED）も書ける
+     *   - 範囲外・不正遷移が 1 つでもあれば何も適用せずエラーを返す（バッチ全体で原子的）
+     *   - 行の差し替えは immer の transient 上で行い、盤面の値は最後に 1 回だけ作る
+     * @param updates 更新要求の先頭
+     * @param count 要求数
+     * @return 成功時は更新後の盤面、失敗時はエラーメッセージ
+     */
+    [[nodiscard]] tl::expected<BasicTetrisGrid, std::string> update_cells(
+        const CellUpdate* updates, std::size_t count) const;
+
+    /// std::array / std::vector など連続領域のコンテナ版
+    template <typename Updates>
+    [[nodiscard]] tl::expected<BasicTetrisGrid, std::string> update_cells(
+        const Updates& updates) const {
+        return this->update_cells(std::data(updates), std::size(updates));
+    }
+
+    [[nodiscard]] tl::expected<BasicTetrisGrid, std::string> update_cells(
+        std::initializer_list<CellUpdate> updates) const {
+        return this->update_cells(updates.begin(), updates.size());
+    }
+
+    /**
+     * 揃った行（全列 FILLED）を消して上の行を詰める
+     *   - 揃った行はビットボードの行ワードが満杯かどうかで判定する
+     *   - 行は flex_vector の erase / push_front で差し替え、残る行ノードはそのまま共有する
+     *   - コストは O(rows)。セル単位の再構築はしない
+     */
+    [[nodiscard]] BasicRowClearResult<MemoryPolicy> clear_full_rows() const;
 
    private:
-    inline immer::vector<immer::vector<Cell>> initialize_cells(const Position& origin,
-                                                               const GridColumnRow& grid_size,
-                                                               const CellFactory& factory) {
-        immer::vector<immer::vector<Cell>> rows;
-        for (int row = 0; row < grid_size.row; ++row) {
-            immer::vector<Cell> columns;
-            for (int col = 0; col < grid_size.column; ++col) {
-                Position cell_pos{
-                    origin.x + col * factory.size.width,
-                    origin.y + row * factory.size.height,
-                };
-                columns = columns.push_back(
-                    factory.create(cell_pos, CellStatus::EMPTY, Color::from_string("white")));
-            }
-            rows = rows.push_back(columns);
-        }
-        return rows;
+    // 行数・列数の検査は create() が行う。ここを通る盤面は常にビットボードの上限に収まる
+    BasicTetrisGrid(std::string id, Position position, Size size, GridColumnRow grid_size,
+                    CellFactory factory, CellRows cells, const GridBitboard& occupancy)
+        : id(std::move(id)),
+          position(position),
+          size(size),
+          grid_size(grid_size),
+          cells(std::move(cells)),
+          cell_factory(std::move(factory)),
+          occupancy(occupancy) {}
+
+    static inline CellRows initialize_cells(const GridColumnRow& grid_size) {
+        // 空行は 1 本だけ作り、全行で共有する
+        return CellRows(static_cast<std::size_t>(grid_size.row), PackedRow{});
     }
 };
 
+/**
+ * 行消去の結果
+ *   - cleared_rows: 消えた行数（0 なら grid は元の盤面と同じ内容）
+ *   - grid: 行を詰めた後の盤面
+ */
+template <typename MemoryPolicy>
+struct BasicRowClearResult {
+    int cleared_rows;
+    BasicTetrisGrid<MemoryPolicy> grid;
+};
+
+/// スレッド間で受け渡せる盤面（描画・シーン用の既定）
+using TetrisGrid = BasicTetrisGrid<board_memory::SharedPolicy>;
+using RowClearResult = BasicRowClearResult<board_memory::SharedPolicy>;
+
+/// 1 スレッドに閉じた盤面（非 atomic の参照カウント。TetrisSimulation 用）
+using LocalTetrisGrid = BasicTetrisGrid<board_memory::LocalPolicy>;
+
+// メンバ関数の定義は TetrisGrid.cpp にあり、使うポリシーの分だけそこで実体化する
+extern template class BasicTetrisGrid<board_memory::SharedPolicy>;
+extern template class BasicTetrisGrid<board_memory::LocalPolicy>;
+
 #endif
@@ -1,30 +1,73 @@
 #ifndef ADFD1949_02B3_4216_A6EB_C0B2714665E9
 #define ADFD1949_02B3_4216_A6EB_C0B2714665E9
+#include <array>
+#include <core/FixedStepDriver.hpp>
 #include <core/Input.hpp>
+#include <core/Random.hpp>
 #include <core/Tetrimino.hpp>
 #include <core/TetrisGrid.hpp>
-#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 // このファイルには、テトリスのルールやテトリミノのキューを管理するクラスを定義します。
 // 複数のゲームオブジェクトからTetrisSceneStateを生成するための各種純粋関数を定義します。
 
+/**
+ * TetriminoTypeQueue ― 次に出すテトリミノの種類を供給するキュー
+ *   - 7 種を 1 袋としてシャッフルし、袋単位で補充する（7-bag）
+ *   - 固定長のリングバッファで、生成後はヒープ確保をしない
+ *   - 乱数は rng::Xoshiro128StarStar。同じシードからはネイティブでも WASM でも同じ並びになる
+ *   - 常に kMaxPeek 個以上を先読み済みに保つので、peek() はその範囲で常に答えられる
+ */
 class TetriminoTypeQueue {
-   private:
-    std::vector<TetriminoType> queue_;
-    void initializeNextTetriminos(int count);
-    TetriminoType getRandomTetriminoType();
-
    public:
+    /// 1 袋の個数
+    static constexpr std::size_t kBagSize = 7;
+    /// リングバッファの容量
+    static constexpr std::size_t kCapacity = 16;
+    /// peek() で覗ける個数（ネクスト表示・AI の先読み用）
+    static constexpr std::size_t kMaxPeek = kCapacity - kBagSize;
+
+    explicit TetriminoTypeQueue(std::uint64_t seed = 0);
+
+    /// 次の種類を取り出す
     TetriminoType getNext();
+
+    /**
+     * index 個先の種類を取り出さずに返す（0 が次に getNext() で出るもの）
+     * @pre index < kMaxPeek
+     */
+    [[nodiscard]] TetriminoType peek(std::size_t index) const noexcept;
+
+   private:
+    rng::Xoshiro128StarStar engine_;
+    std::array<TetriminoType, kCapacity> ring_{};
+    std::size_t head_ = 0;  ///< 次に取り出す位置
+    std::size_t size_ = 0;  ///< 先読み済みの個数
+
+    /// 先読みが count 個以上になるまで袋を補充する
+    void initializeNextTetriminos(std::size_t count);
+
+    /// シャッフルした 1 袋を末尾に積む
+    void pushBag();
 };
 
+static_assert(TetriminoTypeQueue::kMaxPeek + TetriminoTypeQueue::kBagSize - 1 <=
+                  TetriminoTypeQueue::kCapacity,
+              "補充直前の残り + 1 袋がリングに収まること");
+
 class TetrisRule {
    private:
-    const int dropIntervalMillis = 1000;
-    double accumulatedDropTime = 0;
+    const std::uint32_t dropIntervalMillis = 1000;
+    std::uint32_t accumulatedDropTime = 0;
 
    public:
-    Tetrimino drop_tetrimino(const Tetrimino& tetrimino, double delta_time) noexcept;
+    /**
+     * 自然落下を進める
+     * @param delta_millis 経過時間 [ms]。固定ステップ（timestep::kTickMillis）ごとに呼ぶ。
+     *   秒の double を渡して単位を取り違えないよう整数ミリ秒で受ける
+     */
+    Tetrimino drop_tetrimino(const Tetrimino& tetrimino, std::uint32_t delta_millis) noexcept;
 };
 
 #endif /* ADFD1949_02B3_4216_A6EB_C0B2714665E9 */
@@ -0,0 +1,75 @@
+#ifndef E2B7C5D1_8A4F_4C36_9E0B_71F3D9A6C248
+#define E2B7C5D1_8A4F_4C36_9E0B_71F3D9A6C248
+
+#include <core/FixedStepDriver.hpp>
+#include <core/GameConfig.hpp>
+#include <core/Input.hpp>
+#include <core/Tetrimino.hpp>
+#include <core/TetrisGrid.hpp>
+#include <core/TetrisRule.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <tl/expected.hpp>
+
+/**
+ * TetrisSimulation ― 描画・実時間に依存しないテトリス 1 ゲーム分の進行
+ *   - 固定長の整数ティック（kTickMillis）で進める。壁時計は参照しない
+ *   - 同じシードと同じ入力列からは常に同じ盤面・結果になる
+ *   - SDL・IRenderer に依存しないので、ボット評価や回帰テストをヘッドレスで回せる
+ *   - 盤面は LocalTetrisGrid（非 atomic の参照カウント）。1 つのシミュレーションは
+ *     1 スレッドでだけ進める（GameFarm はワーカーごとに作って捨てる）
+ *
+ * 1 ティックの処理順:
+ *   1. 入力（左右移動・回転・ソフトドロップ・ハードドロップ）
+ *   2. TetrisRule による自然落下
+ *   3. 接地していればロック遅延を進め、満了したら固定 → 行消去 → 次のテトリミノを出す
+ */
+class TetrisSimulation {
+   public:
+    /// 1 ティックの長さ [ms]。Game の固定ステップと同じ長さにして、実機と同じ進行を再現する
+    static constexpr std::uint32_t kTickMillis = timestep::kTickMillis;
+
+    /**
+     * 空の盤面から 1 ゲームを開始する
+     * @param config 盤面の行数・列数などの設定
+     * @param seed テトリミノ出現順のシード
+     * @return 成功時はシミュレーション、盤面を作れない場合はエラーメッセージ
+     */
+    [[nodiscard]] static tl::expected<TetrisSimulation, std::string> create(
+        const GameConfig& config, std::uint32_t seed);
+
+    /**
+     * 1 ティック進める（ゲームオーバー後は何もしない）
+     * @param input このティックの入力
+     */
+    void step(const Input& input);
+
+    [[nodiscard]] const LocalTetrisGrid& grid() const noexcept { return *grid_; }
+    [[nodiscard]] const Tetrimino& current_tetrimino() const noexcept { return current_; }
+    [[nodiscard]] bool is_game_over() const noexcept { return game_over_; }
+    [[nodiscard]] std::uint64_t tick_count() const noexcept { return ticks_; }
+    [[nodiscard]] int lines_cleared() const noexcept { return lines_cleared_; }
+    [[nodiscard]] int pieces_locked() const noexcept { return pieces_locked_; }
+
+   private:
+    TetrisSimulation(LocalTetrisGrid grid, std::uint32_t seed);
+
+    /// 操作中のテトリミノを盤面に固定し、行消去して次を出す
+    void lock_current();
+
+    /// 次のテトリミノを盤面上端の中央に出す。置けなければゲームオーバー
+    void spawn_next();
+
+    // 盤面は再代入できないので optional で持ち、更新のたびに emplace する
+    std::optional<LocalTetrisGrid> grid_;
+    Tetrimino current_;
+    TetrisRule rule_;
+    TetriminoTypeQueue queue_;
+    bool game_over_ = false;
+    std::uint64_t ticks_ = 0;
+    int lines_cleared_ = 0;
+    int pieces_locked_ = 0;
+};
+
+#endif /* E2B7C5D1_8A4F_4C36_9E0B_71F3D9A6C248 */
@@ -0,0 +1,122 @@
+#ifndef A7D41C93_5E2B_4F68_9B30_C8E6F1D2A574
+#define A7D41C93_5E2B_4F68_9B30_C8E6F1D2A574
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <tl/expected.hpp>
+#include <utility>
+#include <vector>
+
+// トレースの有効・無効（CMake の TETRIS_TRACE オプションで切り替える）。
+// 0 のとき TRACE_SCOPE は何も生成しない。
+#ifndef TETRIS_TRACE
+#define TETRIS_TRACE 0
+#endif
+
+/**
+ * trace ― Chrome trace-event 形式（Perfetto / chrome://tracing で開ける）のタイムライン記録
+ *   - TRACE_SCOPE でスコープの開始時刻と所要時間を記録する（"X" 完了イベント）
+ *   - 記録先はスレッドごとのリングバッファ。確保とロックはスレッドの初回記録時だけ
+ *   - バッファが一杯になると古いイベントから上書きする（直近 kRingCapacity 件が残る）
+ *   - flush_to_file / write_chrome_json で書き出す。記録中の他スレッドのバッファは
+ *     書き出しと競合し得るので、書き出しはフレームの切れ目か終了時に行う
+ */
+namespace trace {
+using Clock = std::chrono::steady_clock;
+
+/// スレッドあたりに保持するイベント数
+constexpr std::size_t kRingCapacity = 1u << 14;
+static_assert((kRingCapacity & (kRingCapacity - 1)) == 0, "リングの容量は 2 の冪");
+
+/// 記録 1 件。名前・カテゴリは文字列リテラル（寿命がプログラム全体）であること
+struct Event {
+    const char* category;
+    const char* name;
+    std::int64_t start_us;     ///< プロセス開始からの経過 [µs]
+    std::int64_t duration_us;  ///< 所要時間 [µs]
+    std::uint32_t depth;       ///< 記録したスレッドでの入れ子の深さ（最も外側が 0）
+};
+
+/// 1 スレッド分のリングバッファ（書き込むのは所有スレッドのみ）
+struct ThreadBuffer {
+    std::uint32_t thread_id = 0;
+    std::atomic<std::uint64_t> written{0};  ///< これまでに書いた件数
+    std::array<Event, kRingCapacity> events{};
+};
+
+/// 記録の一時停止・再開（コンパイル時に有効な場合のみ意味を持つ）
+void set_enabled(bool enabled) noexcept;
+[[nodiscard]] bool is_enabled() noexcept;
+
+/// プロセス開始からの経過 [µs]
+[[nodiscard]] std::int64_t to_micros(Clock::time_point time) noexcept;
+
+/// 呼び出しスレッドのリングバッファに 1 件記録する
+void record(const char* category, const char* name, Clock::time_point start,
+            Clock::time_point end, std::uint32_t depth = 0) noexcept;
+
+/**
+ * 全スレッドの記録を開始時刻順に集める
+ *   - 開始時刻が同じなら長い方、長さも同じなら浅い方（外側）を先に置く
+ *   - それでも並ばないもの（同時刻に始まった長さ 0 の兄弟など）はスレッド内の記録順を保つ
+ */
+[[nodiscard]] std::vector<std::pair<std::uint32_t, Event>> collect();
+
+/// Chrome trace-event JSON（{"traceEvents": [...]}）を書き出す
+void write_chrome_json(std::ostream& out);
+
+/**
+ * Chrome trace-event JSON をファイルに書き出す
+ * @return 失敗時はエラーメッセージ
+ */
+[[nodiscard]] tl::expected<void, std::string> flush_to_file(const std::string& path);
+
+/// 記録をすべて捨てる（記録中のスレッドがないときに呼ぶ）
+void clear() noexcept;
+
+/// 終了時（std::exit / main からの return）に path へ書き出す。2 回目以降は path の更新のみ
+void flush_at_exit(const std::string& path);
+
+/// スコープの所要時間を記録する
+class Zone {
+   public:
+    Zone(const char* category, const char* name) noexcept
+        : category_(category), name_(name), depth_(depth()++), start_(Clock::now()) {}
+    ~Zone() {
+        --depth();
+        if (is_enabled()) record(category_, name_, start_, Clock::now(), depth_);
+    }
+
+    Zone(const Zone&) = delete;
+    Zone& operator=(const Zone&) = delete;
+
+   private:
+    const char* category_;
+    const char* name_;
+    std::uint32_t depth_;
+    Clock::time_point start_;
+
+    /// このスレッドで開いている Zone の数
+    static std::uint32_t& depth() noexcept {
+        thread_local std::uint32_t open_zones = 0;
+        return open_zones;
+    }
+};
+}  // namespace trace
+
+// スコープ計測。TETRIS_TRACE が 0 なら何も生成しない
+#define TETRIS_TRACE_CONCAT_(a, b) a##b
+#define TETRIS_TRACE_NAME_(line) TETRIS_TRACE_CONCAT_(trace_zone_, line)
+#if TETRIS_TRACE
+#define TRACE_SCOPE(category, name) \
+    ::trace::Zone TETRIS_TRACE_NAME_(__LINE__) { category, name }
+#else
+#define TRACE_SCOPE(category, name) static_cast<void>(0)
+#endif
+
+#endif /* A7D41C93_5E2B_4F68_9B30_C8E6F1D2A574 */
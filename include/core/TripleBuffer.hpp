@@ -0,0 +1,67 @@
+#ifndef E5B1C7A3_9D24_4F68_8A3E_2C6F0B9D4E17
+#define E5B1C7A3_9D24_4F68_8A3E_2C6F0B9D4E17
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * TripleBuffer ― 書き手 1 スレッド・読み手 1 スレッドの間で「最新の値」だけを受け渡す
+ *   - 3 つの枠を「書き込み中（back）」「受け渡し待ち（middle）」「読み取り中（front）」で回す。
+ *     publish / consume は middle の添字を atomic に交換するだけで、ロックも待ちもない
+ *   - 読み手が追いつかなければ古い値は上書きされる（publish が true を返す）。
+ *     書き手は読み手の速さに関係なく進める
+ *   - back() は書き手だけ、front() は読み手だけが触ること。publish 後の back() には
+ *     以前の値が残っているので、書き手が作り直すこと
+ */
+template <typename T>
+class TripleBuffer {
+   public:
+    explicit TripleBuffer(const T& initial = T{}) : slots_{{initial, initial, initial}} {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /// 書き込み中の枠（書き手専用）
+    [[nodiscard]] T& back() noexcept { return slots_[back_]; }
+
+    /**
+     * 書き込み中の枠を読み手に渡し、空いた枠を次の書き込み先にする（書き手専用）
+     * @return まだ読まれていない値を上書きしたら true
+     */
+    bool publish() noexcept {
+        const std::uint8_t previous =
+            middle_.exchange(static_cast<std::uint8_t>(back_ | kDirty), std::memory_order_acq_rel);
+        back_ = previous & kIndexMask;
+        return (previous & kDirty) != 0;
+    }
+
+    /**
+     * 新しい値があれば読み取り中の枠と入れ替える（読み手専用）
+     * @return 入れ替えたら true（front() が新しい値になる）
+     */
+    bool consume() noexcept {
+        if ((middle_.load(std::memory_order_relaxed) & kDirty) == 0) return false;
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndexMask;
+        return true;
+    }
+
+    /// まだ読まれていない値があるか（どちらのスレッドから呼んでもよい）
+    [[nodiscard]] bool has_update() const noexcept {
+        return (middle_.load(std::memory_order_acquire) & kDirty) != 0;
+    }
+
+    /// 読み取り中の枠（読み手専用）
+    [[nodiscard]] const T& front() const noexcept { return slots_[front_]; }
+
+   private:
+    static constexpr std::uint8_t kIndexMask = 0x3;
+    static constexpr std::uint8_t kDirty = 0x4;  ///< middle が未読の値を指している
+
+    std::array<T, 3> slots_;
+    std::uint8_t back_ = 0;
+    std::atomic<std::uint8_t> middle_{1};
+    std::uint8_t front_ = 2;
+};
+
+#endif /* E5B1C7A3_9D24_4F68_8A3E_2C6F0B9D4E17 */
@@ -2,8 +2,11 @@
 #define FDF1996A_28A1_4BB6_9350_B2E7149BB007
 
 #include <core/Position.hpp>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 
 /** RGBA カラー（0-255 範囲） */
 struct Color {
@@ -11,9 +14,178 @@ struct Color {
     std::uint8_t g{0};
     std::uint8_t b{0};
     std::uint8_t a{255};
+
+    /**
+     * 文字列からColorを生成（parse() の std::string 版。設定ファイルなど実行時の入力向け）
+     */
     static Color from_string(std::string color_str);
+
+    /**
+     * 文字列からColorを生成（コンパイル時にも評価できる）
+     *   - 名前（"black" など）/ #rgb / #rgba / #rrggbb / #rrggbbaa / rgb(r,g,b) / rgba(r,g,b,a)
+     *   - 前後の空白と大文字・小文字は無視する
+     *   - 解析できない場合は白
+     */
+    static constexpr Color parse(std::string_view color_str) noexcept;
+};
+
+/** 定義済みカラー（毎フレームの描画ではこちらを使い、文字列の解析を避ける） */
+namespace colors {
+constexpr Color kBlack{0, 0, 0, 255};
+constexpr Color kWhite{255, 255, 255, 255};
+constexpr Color kRed{255, 0, 0, 255};
+constexpr Color kGreen{0, 255, 0, 255};
+constexpr Color kBlue{0, 0, 255, 255};
+constexpr Color kYellow{255, 255, 0, 255};
+constexpr Color kCyan{0, 255, 255, 255};
+constexpr Color kMagenta{255, 0, 255, 255};
+constexpr Color kTransparent{0, 0, 0, 0};
+}  // namespace colors
+
+// ────────────────── constexpr 色文字列パーサ ──────────────────
+namespace color_parser {
+
+constexpr bool is_space(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+constexpr bool same_color(Color x, Color y) noexcept {
+    return x.r == y.r && x.g == y.g && x.b == y.b && x.a == y.a;
+}
+
+constexpr char to_lower(char c) noexcept { return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c; }
+
+constexpr std::string_view trim(std::string_view s) noexcept {
+    while (!s.empty() && is_space(s.front())) s.remove_prefix(1);
+    while (!s.empty() && is_space(s.back())) s.remove_suffix(1);
+    return s;
+}
+
+/// 大文字・小文字を区別せずに比較（pattern は小文字で渡す）
+constexpr bool iequals(std::string_view s, std::string_view pattern) noexcept {
+    if (s.size() != pattern.size()) return false;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        if (to_lower(s[i]) != pattern[i]) return false;
+    }
+    return true;
+}
+
+constexpr bool istarts_with(std::string_view s, std::string_view prefix) noexcept {
+    return s.size() >= prefix.size() && iequals(s.substr(0, prefix.size()), prefix);
+}
+
+constexpr int hex_digit(char c) noexcept {
+    c = to_lower(c);
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+constexpr std::uint8_t clamp_channel(long v) noexcept {
+    return static_cast<std::uint8_t>(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+/// #rgb / #rgba / #rrggbb / #rrggbbaa（先頭の # を除いた部分）
+constexpr std::optional<Color> parse_hex(std::string_view hex) noexcept {
+    const std::size_t n = hex.size();
+    if (n != 3 && n != 4 && n != 6 && n != 8) return std::nullopt;
+    const bool short_form = n <= 4;
+    const std::size_t channels = short_form ? n : n / 2;
+
+    std::uint8_t v[4] = {0, 0, 0, 255};  // α省略時は FF
+    for (std::size_t i = 0; i < channels; ++i) {
+        const int hi = hex_digit(hex[short_form ? i : i * 2]);
+        const int lo = hex_digit(hex[short_form ? i : i * 2 + 1]);
+        if (hi < 0 || lo < 0) return std::nullopt;
+        v[i] = static_cast<std::uint8_t>(hi * 16 + lo);
+    }
+    return Color{v[0], v[1], v[2], v[3]};
+}
+
+/// rgb(...) / rgba(...) の括弧内。各値は 0-255 に丸める
+constexpr std::optional<Color> parse_rgb_like(std::string_view s, bool with_alpha) noexcept {
+    const auto l = s.find('(');
+    const auto r = s.rfind(')');
+    if (l == std::string_view::npos || r == std::string_view::npos || l >= r) return std::nullopt;
+    std::string_view args = s.substr(l + 1, r - l - 1);
+
+    long v[4] = {0, 0, 0, 255};
+    const int count = with_alpha ? 4 : 3;
+    for (int i = 0; i < count; ++i) {
+        args = trim(args);
+        bool negative = false;
+        if (!args.empty() && (args.front() == '-' || args.front() == '+')) {
+            negative = args.front() == '-';
+            args.remove_prefix(1);
+        }
+        if (args.empty() || args.front() < '0' || args.front() > '9') return std::nullopt;
+        long value = 0;
+        while (!args.empty() && args.front() >= '0' && args.front() <= '9') {
+            if (value < 1000) value = value * 10 + (args.front() - '0');
+            args.remove_prefix(1);
+        }
+        v[i] = negative ? -value : value;
+        if (i + 1 < count) {
+            args = trim(args);
+            if (args.empty() || args.front() != ',') return std::nullopt;
+            args.remove_prefix(1);
+        }
+    }
+    return Color{clamp_channel(v[0]), clamp_channel(v[1]), clamp_channel(v[2]),
+                 clamp_channel(v[3])};
+}
+
+struct NamedColor {
+    std::string_view name;
+    Color color;
 };
 
+constexpr NamedColor kNamedColors[] = {
+    {"black", colors::kBlack},   {"white", colors::kWhite},   {"red", colors::kRed},
+    {"green", colors::kGreen},   {"blue", colors::kBlue},     {"yellow", colors::kYellow},
+    {"cyan", colors::kCyan},     {"magenta", colors::kMagenta},
+    {"transparent", colors::kTransparent}};
+
+}  // namespace color_parser
+
+constexpr Color Color::parse(std::string_view color_str) noexcept {
+    using namespace color_parser;
+    const std::string_view s = trim(color_str);
+
+    // ────────── #rrggbb / #rrggbbaa / #rgb / #rgba ──────────
+    if (!s.empty() && s.front() == '#') {
+        if (auto color = parse_hex(s.substr(1))) return *color;
+    }
+
+    // ────────── rgb(r,g,b) / rgba(r,g,b,a) ──────────
+    if (istarts_with(s, "rgb(")) {
+        if (auto color = parse_rgb_like(s, false)) return *color;
+    }
+    if (istarts_with(s, "rgba(")) {
+        if (auto color = parse_rgb_like(s, true)) return *color;
+    }
+
+    // ────────── 定義済みカラー名 ──────────
+    for (const NamedColor& named : kNamedColors) {
+        if (iequals(s, named.name)) return named.color;
+    }
+
+    // 解析失敗時は既定値（白）
+    return colors::kWhite;
+}
+
+// 解析結果はコンパイル時に検証する
+static_assert(color_parser::same_color(Color::parse(" Black "), colors::kBlack));
+static_assert(color_parser::same_color(Color::parse("#00ff00"), colors::kGreen));
+static_assert(color_parser::same_color(Color::parse("#0f08"), Color{0, 255, 0, 136}));
+static_assert(color_parser::same_color(Color::parse("#FF000080"), Color{255, 0, 0, 128}));
+static_assert(color_parser::same_color(Color::parse("rgb(0, 0, 255)"), colors::kBlue));
+static_assert(color_parser::same_color(Color::parse("rgba(255,255,0,128)"),
+                                       Color{255, 255, 0, 128}));
+static_assert(color_parser::same_color(Color::parse("rgb(300,-5,10)"), Color{255, 0, 10, 255}));
+static_assert(color_parser::same_color(Color::parse("#12345"), colors::kWhite));
+static_assert(color_parser::same_color(Color::parse("unknown"), colors::kWhite));
+
 /** 幅・高さを表す 2D サイズ
  *  - width: 幅
  *  - height: 高さ
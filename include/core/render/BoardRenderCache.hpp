@@ -0,0 +1,56 @@
+#ifndef D4F8B2A6_1C7E_4A93_8E5D_3B9C0F6A2E71
+#define D4F8B2A6_1C7E_4A93_8E5D_3B9C0F6A2E71
+
+#include <core/IRenderer.hpp>
+#include <core/TetrisGrid.hpp>
+#include <optional>
+
+/**
+ * BoardRenderCache ― 盤面をオフスクリーンのテクスチャに保持し、変わった行だけ描き直す
+ *   - 前回描いた TetrisGrid を保持し、行ごとに比較する。immer の構造共有で同じ要素を
+ *     指している行はアドレス比較だけで済み、そうでない行はセル 1 バイトずつ値で比べる
+ *   - 変わった行は背景で塗りつぶしてから描き直し、最後にテクスチャを画面へ 1 回で合成する
+ *   - 変化のないフレームの盤面描画は draw_texture 1 回だけになる
+ *   - レンダラが描画先テクスチャに対応しない場合は、毎フレーム TetrisGrid::render で全体を描く
+ */
+class BoardRenderCache {
+   public:
+    /// 空セルの下地（Game::tick の clear と同じ色）
+    static constexpr Color kBackground = colors::kBlack;
+
+    /**
+     * 盤面を描画する
+     * @param renderer 描画先。テクスチャはこのレンダラに作る（別のレンダラに切り替えないこと）
+     * @param grid 描画する盤面
+     */
+    void render(IRenderer& renderer, const TetrisGrid& grid);
+
+    /// 次の render で全行を描き直す（SDL_RENDER_TARGETS_RESET などでテクスチャの中身が消えたとき）
+    void invalidate() noexcept { valid_ = false; }
+
+    /// テクスチャを解放して初期状態に戻す
+    void release(IRenderer& renderer);
+
+    /// 直前の render で描き直した行
+    [[nodiscard]] TetrisGrid::RowMask last_redrawn_rows() const noexcept { return last_redrawn_; }
+
+    /// オフスクリーンのテクスチャを使っているか
+    [[nodiscard]] bool is_cached() const noexcept { return target_.has_value(); }
+
+   private:
+    std::optional<TetrisGrid> last_grid_;  ///< 前回描いた盤面（行の比較元）
+    std::optional<TextureId> target_;
+    int target_width_ = 0;
+    int target_height_ = 0;
+    bool valid_ = false;        ///< テクスチャの中身が last_grid_ と一致しているか
+    bool unsupported_ = false;  ///< 描画先テクスチャを使えないレンダラだった
+    TetrisGrid::RowMask last_redrawn_ = 0;
+
+    /// last_grid_ から変わった行
+    [[nodiscard]] TetrisGrid::RowMask changed_rows(const TetrisGrid& grid) const;
+
+    /// テクスチャを使わずに全体を描く
+    void render_uncached(IRenderer& renderer, const TetrisGrid& grid);
+};
+
+#endif /* D4F8B2A6_1C7E_4A93_8E5D_3B9C0F6A2E71 */
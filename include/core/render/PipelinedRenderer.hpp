@@ -0,0 +1,166 @@
+#ifndef B7F4D2E8_3A51_4C96_9B0E_6D8A2F1C5E39
+#define B7F4D2E8_3A51_4C96_9B0E_6D8A2F1C5E39
+
+#include <atomic>
+#include <condition_variable>
+#include <core/IRenderer.hpp>
+#include <core/TripleBuffer.hpp>
+#include <core/render/RecordingRenderer.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tl/expected.hpp>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * PipelinedRenderer ― 描画を専用スレッドに移し、ロジックのティックを Present の待ちから切り離す
+ *   - ロジック側（Game::tick）から見ると普通の IRenderer。描画命令は RecordingRenderer に記録し、
+ *     end_frame でその命令列を TripleBuffer で描画スレッドに渡すだけで、待たない
+ *   - 描画スレッドは実際のレンダラを所有し、届いた最新のフレームを再生して Present する。
+ *     描画が追いつかなければ古いフレームは捨てる（frames_dropped）
+ *   - レンダラは描画スレッドの上で factory から作り、そのスレッドで破棄する（SDL_Renderer は
+ *     作ったスレッドでしか使えないため）。ウィンドウの作成とイベント処理は呼び出し側のスレッドに残す
+ *   - フォント・テクスチャの作成は描画スレッドで実行して結果を待つ（シーンの初期化時だけの想定）。
+ *     解放は待たずに依頼し、それまでに渡したフレームを描き終えてから実行する
+ *   - ネイティブ専用（Emscripten はブラウザのフレームコールバックで回すので使わない）
+ */
+class PipelinedRenderer final : public IRenderer {
+   public:
+    /// 描画スレッドの上で呼ばれ、実際に描くレンダラを作る
+    using RendererFactory =
+        std::function<tl::expected<std::unique_ptr<IRenderer>, std::string>()>;
+
+    /**
+     * 描画スレッドを起動し、その上でレンダラを作る
+     * @param factory レンダラの生成（描画スレッドで 1 回だけ呼ぶ）
+     * @param width  画面の幅（記録側の統計に使う）
+     * @param height 画面の高さ
+     * @return 成功: PipelinedRenderer, 失敗: factory のエラーメッセージ
+     */
+    [[nodiscard]] static tl::expected<std::unique_ptr<PipelinedRenderer>, std::string> create(
+        RendererFactory factory, int width, int height);
+
+    PipelinedRenderer(const PipelinedRenderer&) = delete;
+    PipelinedRenderer& operator=(const PipelinedRenderer&) = delete;
+
+    /// 渡し済みのフレームと依頼を処理してから描画スレッドを止める
+    ~PipelinedRenderer() override;
+
+    // フレーム制御 ----------------------------------------------------------
+    void begin_frame() override;
+    /// 記録したフレームを描画スレッドに渡す（Present は待たない）
+    void end_frame() override;
+    /**
+     * 描画スレッドのレンダラに垂直同期を依頼する
+     * @return 常に false。Present の待ちは描画スレッドだけが受け持つので、ロジック側のループは
+     *         垂直同期に頼らず FramePacer の TARGET_FPS で刻むこと
+     */
+    bool set_vsync(bool enabled) override;
+
+    void clear(Color color = {0, 0, 0, 255}) override;
+
+    // プリミティブ描画（記録するだけ）------------------------------------------
+    void fill_rect(const Rect& rect, Color color) override;
+    void stroke_rect(const Rect& rect, Color color) override;
+    void fill_rects(const ColoredRect* rects, std::size_t count) override;
+    void stroke_rects(const Rect* rects, std::size_t count, Color color) override;
+    void draw_line(Position start, Position end, Color color) override;
+    void draw_texture(TextureId id, const Rect& src_region, const Rect& dst_region,
+                      double angle = 0.0) override;
+
+    // オフスクリーン描画・リソース（描画スレッドで実行する）--------------------
+    [[nodiscard]]
+    tl::expected<TextureId, std::string> create_render_target(int width, int height) override;
+    bool set_render_target(std::optional<TextureId> target) override;
+    void release_texture(TextureId id) override;
+    [[nodiscard]]
+    tl::expected<TextureId, std::string> load_texture(const std::string& path) override;
+    [[nodiscard]]
+    tl::expected<FontId, std::string> register_font(const std::string& path, int pt_size) override;
+    void release_font(FontId id) override;
+    [[nodiscard]]
+    tl::expected<void, std::string> draw_text(FontId font_id, const std::string& utf8, Position pos,
+                                              Color color) override;
+
+    // 統計 ------------------------------------------------------------------
+    /// 最後に渡したフレームの描画統計（ロジック側のスレッド専用）
+    [[nodiscard]] const RenderStats& last_frame_stats() const noexcept { return last_stats_; }
+
+    [[nodiscard]] std::uint64_t frames_published() const noexcept {
+        return published_.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] std::uint64_t frames_presented() const noexcept {
+        return presented_.load(std::memory_order_relaxed);
+    }
+    /// 描画スレッドが読む前に次のフレームで上書きされた数
+    [[nodiscard]] std::uint64_t frames_dropped() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    using Request = std::function<void(IRenderer&)>;
+
+    /// 描画スレッドに渡す 1 フレーム
+    struct Frame {
+        RecordingRenderer commands;
+        std::uint64_t number = 0;  ///< 何フレーム目か（1 始まり。0 はまだ何も渡していない枠）
+    };
+
+    /// 解放の依頼。after_frame までのフレームを描き終えてから実行する
+    struct Release {
+        std::uint64_t after_frame;
+        Request request;
+    };
+
+    PipelinedRenderer(int width, int height)
+        : frames_(Frame{RecordingRenderer(width, height), 0}) {}
+
+    TripleBuffer<Frame> frames_;
+    RenderStats last_stats_;
+    /// 作成済みの描画先テクスチャの大きさ（ロジック側のスレッド専用）
+    std::unordered_map<TextureId, std::pair<int, int>> targets_;
+
+    std::thread thread_;
+    std::mutex mutex_;  ///< requests_・releases_ と stop_ を守る。描画スレッドを起こすのにも使う
+    std::condition_variable wake_;
+    std::deque<Request> requests_;
+    std::deque<Release> releases_;
+    bool stop_ = false;
+
+    std::atomic<std::uint64_t> published_{0};
+    std::atomic<std::uint64_t> presented_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+
+    /// 描画スレッドの本体
+    void run(RendererFactory factory, std::promise<tl::expected<void, std::string>> ready);
+
+    /// 描画スレッドに処理を依頼する（待たない）
+    void post(Request request);
+
+    /**
+     * 描画スレッドに解放を依頼する（待たない）
+     *   - 依頼までに渡したフレームがすべて描かれる（または新しいフレームに置き換わって捨てられる）
+     *     まで実行しない。フレームの命令列が解放済みのフォント・テクスチャを使わないようにする
+     */
+    void post_release(Request request);
+
+    /// 記録中のフレーム（ロジック側のスレッド専用）
+    [[nodiscard]] RecordingRenderer& recording() noexcept { return this->frames_.back().commands; }
+
+    /// 描画スレッドで fn を実行し、結果を待って返す
+    template <typename Result>
+    Result call(std::function<Result(IRenderer&)> fn) {
+        auto task = std::make_shared<std::packaged_task<Result(IRenderer&)>>(std::move(fn));
+        std::future<Result> result = task->get_future();
+        this->post([task](IRenderer& renderer) { (*task)(renderer); });
+        return result.get();
+    }
+};
+
+#endif /* B7F4D2E8_3A51_4C96_9B0E_6D8A2F1C5E39 */
@@ -0,0 +1,65 @@
+#ifndef F2B7D4C9_6A31_4E85_B9C2_8D5E3A1F7B06
+#define F2B7D4C9_6A31_4E85_B9C2_8D5E3A1F7B06
+
+#include <core/graphics_types.hpp>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * pixel_ops ― RGBA8 ピクセル列の塗り・合成
+ *   - 1 ピクセルは std::uint32_t 1 つ。r が最下位バイト（リトルエンディアンのメモリ上で R, G, B, A）
+ *   - 合成は「src over dst」: 各チャンネル out = (src × a + dst × (255 − a)) / 255（四捨五入）。
+ *     アルファは src を 255 とみなして同じ式で求める
+ *   - blend_span は SSE2 / AVX2 / wasm simd128 のうちコンパイル時に使えるもので処理し、
+ *     端数はスカラーで処理する。どの経路でも blend_pixel と同じ結果になる
+ */
+namespace pixel_ops {
+
+[[nodiscard]] constexpr std::uint32_t pack(Color c) noexcept {
+    return static_cast<std::uint32_t>(c.r) | (static_cast<std::uint32_t>(c.g) << 8) |
+           (static_cast<std::uint32_t>(c.b) << 16) | (static_cast<std::uint32_t>(c.a) << 24);
+}
+
+[[nodiscard]] constexpr Color unpack(std::uint32_t p) noexcept {
+    return Color{static_cast<std::uint8_t>(p), static_cast<std::uint8_t>(p >> 8),
+                 static_cast<std::uint8_t>(p >> 16), static_cast<std::uint8_t>(p >> 24)};
+}
+
+/// x / 255 の四捨五入（x ≤ 255 × 255）
+[[nodiscard]] constexpr std::uint32_t div255(std::uint32_t x) noexcept {
+    const std::uint32_t t = x + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+/// 1 ピクセルの合成（SIMD 経路の基準になるスカラー実装）
+[[nodiscard]] constexpr std::uint32_t blend_pixel(std::uint32_t dst, Color src) noexcept {
+    const std::uint32_t a = src.a;
+    const std::uint32_t inv = 255 - a;
+    const std::uint32_t s[4] = {src.r, src.g, src.b, 255};
+    std::uint32_t out = 0;
+    for (int channel = 0; channel < 4; ++channel) {
+        const std::uint32_t d = (dst >> (channel * 8)) & 0xFF;
+        out |= div255(s[channel] * a + d * inv) << (channel * 8);
+    }
+    return out;
+}
+
+static_assert(div255(255 * 255) == 255 && div255(0) == 0 && div255(127) == 0 && div255(128) == 1);
+static_assert(blend_pixel(pack(colors::kBlack), Color{255, 255, 255, 255}) == 0xFFFFFFFFu);
+static_assert(blend_pixel(0x12345678u, colors::kTransparent) == 0x12345678u);
+
+/// count ピクセルを同じ色で上書きする
+void fill_span(std::uint32_t* dst, std::size_t count, Color color) noexcept;
+
+/// count ピクセルに同じ色を合成する（不透明なら fill_span、完全透明なら何もしない）
+void blend_span(std::uint32_t* dst, std::size_t count, Color color) noexcept;
+
+/// スカラーだけで合成する（SIMD 経路の検証用）
+void blend_span_scalar(std::uint32_t* dst, std::size_t count, Color color) noexcept;
+
+/// blend_span が使う命令セットの名前（"avx2" / "sse2" / "simd128" / "scalar"）
+[[nodiscard]] const char* simd_backend() noexcept;
+
+}  // namespace pixel_ops
+
+#endif /* F2B7D4C9_6A31_4E85_B9C2_8D5E3A1F7B06 */
@@ -0,0 +1,185 @@
+#ifndef C3E8A1D5_7B42_4F96_A2C7_9D1E6B3F8A54
+#define C3E8A1D5_7B42_4F96_A2C7_9D1E6B3F8A54
+
+#include <core/IRenderer.hpp>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <tl/expected.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/** RecordingRenderer が記録する命令の種類 */
+enum class RenderOp : std::uint8_t {
+    BEGIN_FRAME,
+    END_FRAME,
+    SET_VSYNC,
+    CLEAR,
+    FILL_RECT,
+    STROKE_RECT,
+    FILL_RECTS,
+    STROKE_RECTS,
+    DRAW_LINE,
+    DRAW_TEXTURE,
+    CREATE_RENDER_TARGET,
+    SET_RENDER_TARGET,
+    RELEASE_TEXTURE,
+    LOAD_TEXTURE,
+    REGISTER_FONT,
+    RELEASE_FONT,
+    DRAW_TEXT,
+};
+
+[[nodiscard]] const char* to_string(RenderOp op) noexcept;
+
+/**
+ * 1 フレーム分の描画統計
+ *   - draw_calls: バックエンドへの描画呼び出し（clear と空のまとめ描きは数えない。
+ *     fill_rects は要素数に関係なく 1 回）
+ *   - state_changes: 描画色・テクスチャ・描画先の切り替え（直前と同じなら数えない）
+ *   - pixels_covered: 描画先に収まる範囲で書いたピクセル数の合計（clear を含む。文字列は含まない）
+ */
+struct RenderStats {
+    std::size_t draw_calls = 0;
+    std::size_t primitives = 0;  ///< 矩形・線・テクスチャ・文字列の数
+    std::size_t state_changes = 0;
+    std::uint64_t pixels_covered = 0;
+    std::uint64_t viewport_pixels = 0;  ///< 画面の面積
+
+    /// 画面の各ピクセルが平均何回書かれたか
+    [[nodiscard]] double overdraw() const noexcept {
+        return viewport_pixels == 0 ? 0.0
+                                    : static_cast<double>(pixels_covered) /
+                                          static_cast<double>(viewport_pixels);
+    }
+};
+
+/**
+ * RecordingRenderer ― 描画せずに、呼ばれた命令を命令列として記録するレンダラ
+ *   - 命令は 1 本のバイト列（アリーナ）に「種類 1 バイト + 固定長の引数 + 可変長の配列・文字列」で
+ *     詰める。clear_commands() は容量を残すので、2 フレーム目以降は確保が発生しない
+ *   - replay() で別の IRenderer に同じ順に流し直せる。フォント・テクスチャの ID は再生先で
+ *     作り直したものに対応付ける
+ *   - begin_frame 〜 end_frame の間の描画呼び出し数・状態切り替え数・オーバードローを数える
+ *   - dump() は命令列を 1 行 1 命令の文字列にする（ゴールデンテストの比較用）
+ */
+class RecordingRenderer final : public IRenderer {
+   public:
+    /**
+     * @param width  画面の幅（オーバードローの分母と描画範囲の切り取りに使う）
+     * @param height 画面の高さ
+     */
+    RecordingRenderer(int width, int height) noexcept;
+
+    // フレーム制御 ----------------------------------------------------------
+    void begin_frame() override;
+    void end_frame() override;
+    bool set_vsync(bool enabled) override;
+
+    void clear(Color color = {0, 0, 0, 255}) override;
+
+    // プリミティブ描画 ------------------------------------------------------
+    void fill_rect(const Rect& rect, Color color) override;
+    void stroke_rect(const Rect& rect, Color color) override;
+    void fill_rects(const ColoredRect* rects, std::size_t count) override;
+    void stroke_rects(const Rect* rects, std::size_t count, Color color) override;
+    void draw_line(Position start, Position end, Color color) override;
+    void draw_texture(TextureId id, const Rect& src_region, const Rect& dst_region,
+                      double angle = 0.0) override;
+
+    // オフスクリーン描画・リソース（ID を払い出して記録する。実体は作らない）----
+    [[nodiscard]]
+    tl::expected<TextureId, std::string> create_render_target(int width, int height) override;
+    bool set_render_target(std::optional<TextureId> target) override;
+    void release_texture(TextureId id) override;
+    [[nodiscard]]
+    tl::expected<TextureId, std::string> load_texture(const std::string& path) override;
+    [[nodiscard]]
+    tl::expected<FontId, std::string> register_font(const std::string& path, int pt_size) override;
+    void release_font(FontId id) override;
+    [[nodiscard]]
+    tl::expected<void, std::string> draw_text(FontId font_id, const std::string& utf8, Position pos,
+                                              Color color) override;
+
+    // 記録の利用 ------------------------------------------------------------
+    /**
+     * 記録した命令を順に target へ流す
+     *   - 記録中に払い出した ID は、再生中に target で作ったフォント・テクスチャに置き換える
+     * @return 成功: void, 失敗: target でフォント・テクスチャを作れなかった場合のエラーメッセージ
+     */
+    [[nodiscard]] tl::expected<void, std::string> replay(IRenderer& target) const;
+
+    /// 命令を 1 行ずつ書き出す（座標は小数点以下を省いた最短表記、色は #rrggbbaa）
+    void dump(std::ostream& out) const;
+    [[nodiscard]] std::string dump() const;
+
+    /**
+     * 別のレンダラで作った描画先テクスチャを set_render_target で使えるようにする（記録はしない）
+     *   - 再生先と ID を共有する使い方（PipelinedRenderer）向け
+     */
+    void adopt_render_target(TextureId id, int width, int height);
+
+    /// 記録した命令を捨てる（統計とアリーナの容量は残す）
+    void clear_commands() noexcept;
+
+    /**
+     * 統計と状態切り替えの判定を捨てる（画面の面積は残す）
+     *   - 同じ記録を別のフレームとして使い回す前に呼ぶ（PipelinedRenderer の枠）
+     */
+    void reset_stats() noexcept;
+
+    [[nodiscard]] std::size_t command_count() const noexcept { return command_count_; }
+    [[nodiscard]] std::size_t arena_bytes() const noexcept { return arena_.size(); }
+
+    /// 記録中のフレーム（begin_frame 以降）の統計
+    [[nodiscard]] const RenderStats& current_frame() const noexcept { return current_; }
+    /// end_frame で確定したフレームの統計（古い順）
+    [[nodiscard]] const std::vector<RenderStats>& frames() const noexcept { return frames_; }
+
+   private:
+    /// 命令列の読み出し位置
+    struct Cursor;
+    /// 1 命令を読み出した結果
+    struct Command;
+
+    int width_;
+    int height_;
+    std::vector<std::uint8_t> arena_;
+    std::size_t command_count_ = 0;
+
+    RenderStats current_;
+    std::vector<RenderStats> frames_;
+
+    // 払い出した ID と状態切り替えの判定用
+    TextureId next_texture_id_{1};
+    FontId next_font_id_{0};
+    std::unordered_map<TextureId, std::pair<int, int>> target_sizes_;
+    std::optional<TextureId> target_;
+    std::optional<std::uint32_t> last_color_;
+    std::optional<std::uint64_t> last_texture_;  ///< テクスチャ ID、フォントは 2^32 を足した値
+
+    void put_op(RenderOp op);
+    void put_bytes(const void* data, std::size_t size);
+    template <typename T>
+    void put(const T& value) {
+        this->put_bytes(&value, sizeof(T));
+    }
+    void put_string(std::string_view text);
+
+    /// 描画呼び出しとして数える
+    void count_draw(std::size_t primitives);
+    void use_color(Color color);
+    void use_texture(std::uint64_t key);
+    /// 現在の描画先（画面または描画先テクスチャ）の大きさ
+    [[nodiscard]] std::pair<int, int> target_size() const;
+    /// 描画先に収まる面積を pixels_covered に足す
+    void cover(const Rect& rect);
+    /// 1 ピクセル幅の枠線の面積を足す（角は 1 回だけ）
+    void cover_outline(const Rect& rect);
+
+    [[nodiscard]] static Command read(Cursor& cursor);
+};
+
+#endif /* C3E8A1D5_7B42_4F96_A2C7_9D1E6B3F8A54 */
@@ -0,0 +1,117 @@
+#ifndef A6D3E9F1_4B27_4C8A_9E15_7F2C8B0D5A43
+#define A6D3E9F1_4B27_4C8A_9E15_7F2C8B0D5A43
+
+#include <core/IRenderer.hpp>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tl/expected.hpp>
+#include <unordered_map>
+#include <vector>
+
+/** RGBA8 のピクセル配列（1 ピクセル = pixel_ops::pack の std::uint32_t、行の隙間なし） */
+struct Framebuffer {
+    int width = 0;
+    int height = 0;
+    std::vector<std::uint32_t> pixels;
+
+    [[nodiscard]] std::uint32_t* row(int y) noexcept {
+        return pixels.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(width);
+    }
+    [[nodiscard]] const std::uint32_t* row(int y) const noexcept {
+        return pixels.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(width);
+    }
+    [[nodiscard]] std::uint32_t at(int x, int y) const noexcept { return row(y)[x]; }
+};
+
+/**
+ * SoftwareRenderer ― ウィンドウも GPU も使わず、メモリ上の RGBA8 フレームバッファに描く
+ *   - リプレイの大量フレームを CPU だけの CI で描き、描画コストを測るためのバックエンド
+ *   - 矩形は行ごとのスパンにして pixel_ops::blend_span（SIMD）で合成する。
+ *     合成式と座標の丸め（double → int の切り捨て）は SDLRenderer の SDL_BLENDMODE_BLEND に合わせる
+ *   - 描画先テクスチャと draw_texture（最近傍・回転なし）に対応するので BoardRenderCache も使える
+ *   - フォントは扱わない（register_font / draw_text はエラーを返す）
+ *   - 描いた結果は framebuffer() で読み出すか、write_png / write_raw でファイルに書き出す
+ */
+class SoftwareRenderer final : public IRenderer {
+   public:
+    /**
+     * ファクトリ関数
+     * @param width  画面の幅（ピクセル）
+     * @param height 画面の高さ（ピクセル）
+     * @return 成功: std::unique_ptr<SoftwareRenderer>, 失敗: サイズが不正な場合のエラーメッセージ
+     */
+    [[nodiscard]] static tl::expected<std::unique_ptr<SoftwareRenderer>, std::string> create(
+        int width, int height);
+
+    SoftwareRenderer(const SoftwareRenderer&) = delete;
+    SoftwareRenderer& operator=(const SoftwareRenderer&) = delete;
+
+    // フレーム制御 ----------------------------------------------------------
+    void begin_frame() override {}
+    void end_frame() override { ++frame_count_; }
+
+    // 画面クリア（合成せずに上書きする。SDL_RenderClear と同じ）--------------
+    void clear(Color color = {0, 0, 0, 255}) override;
+
+    // プリミティブ描画 ------------------------------------------------------
+    void fill_rect(const Rect& rect, Color color) override;
+    /// 1 ピクセル幅の枠線（角は 1 回だけ合成する）
+    void stroke_rect(const Rect& rect, Color color) override;
+    /// 両端を含む Bresenham 線
+    void draw_line(Position start, Position end, Color color) override;
+
+    /// 最近傍で拡大縮小して合成する（angle は無視する）
+    void draw_texture(TextureId id, const Rect& src_region, const Rect& dst_region,
+                      double angle = 0.0) override;
+
+    // オフスクリーン描画 ----------------------------------------------------
+    [[nodiscard]]
+    tl::expected<TextureId, std::string> create_render_target(int width, int height) override;
+    bool set_render_target(std::optional<TextureId> target) override;
+    void release_texture(TextureId id) override;
+
+    // フォント関連（未対応）--------------------------------------------------
+    [[nodiscard]]
+    tl::expected<FontId, std::string> register_font(const std::string& path, int pt_size) override;
+    [[nodiscard]]
+    tl::expected<void, std::string> draw_text(FontId font_id, const std::string& utf8, Position pos,
+                                              Color color) override;
+
+    // 結果の取り出し --------------------------------------------------------
+    /// 画面のフレームバッファ（描画先テクスチャではなく常に画面）
+    [[nodiscard]] const Framebuffer& framebuffer() const noexcept { return screen_; }
+
+    /// end_frame を呼んだ回数
+    [[nodiscard]] std::uint64_t frame_count() const noexcept { return frame_count_; }
+
+    /// 画面を PNG（RGBA8、無圧縮の deflate）に書き出す
+    [[nodiscard]] tl::expected<void, std::string> write_png(const std::string& path) const;
+
+    /// 画面を生の RGBA8（ヘッダなし、上の行から width × height × 4 バイト）で書き出す
+    [[nodiscard]] tl::expected<void, std::string> write_raw(const std::string& path) const;
+
+   private:
+    explicit SoftwareRenderer(Framebuffer screen) noexcept : screen_{std::move(screen)} {}
+
+    Framebuffer screen_;
+    std::unordered_map<TextureId, Framebuffer> textures_;
+    TextureId next_id_{1};
+    std::optional<TextureId> target_;  ///< std::nullopt なら画面に描く
+    std::uint64_t frame_count_ = 0;
+
+    /// 現在の描画先
+    Framebuffer& target() noexcept;
+
+    /// 描画先に収まる範囲だけ、横 [x0, x1) × 縦 [y0, y1) を合成する
+    void blend_rect(int x0, int y0, int x1, int y1, Color color);
+};
+
+/**
+ * フレームバッファを PNG にエンコードする
+ *   - 圧縮はせず deflate の無圧縮ブロックで格納する（zlib に依存しない。大きさより速さを優先）
+ */
+[[nodiscard]] std::vector<std::uint8_t> encode_png(const Framebuffer& framebuffer);
+
+#endif /* A6D3E9F1_4B27_4C8A_9E15_7F2C8B0D5A43 */
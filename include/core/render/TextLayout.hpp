@@ -0,0 +1,212 @@
+#ifndef B6E3F9A1_4D72_4C58_9A1E_7F0C2D8B5A36
+#define B6E3F9A1_4D72_4C58_9A1E_7F0C2D8B5A36
+
+#include <algorithm>
+#include <core/IRenderer.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * UTF-8 を符号位置の列に展開する
+ *   - 不正なバイト列・サロゲート・範囲外は U+FFFD に置き換える（描画を止めない）
+ * @param utf8 UTF-8 文字列
+ * @param out 展開先（末尾に追加する）
+ */
+void decode_utf8(std::string_view utf8, std::vector<char32_t>& out);
+
+/**
+ * ShelfPacker ― 矩形をテクスチャに棚（shelf）詰めで配置する
+ *   - 高さが近い棚（1.25 倍以内）の右端に置き、なければ下に新しい棚を開く
+ *   - 削除はしない。一杯になったら reset() で全体を空け直す（呼び出し側で中身を作り直す）
+ *   - 矩形の間には padding ピクセルの隙間を空ける（線形補間のにじみ防止）
+ */
+class ShelfPacker {
+   public:
+    struct Placement {
+        int x;
+        int y;
+    };
+
+    ShelfPacker(int width, int height, int padding = 1) noexcept
+        : width_(width), height_(height), padding_(padding) {}
+
+    /// w × h の矩形を置く。入らなければ std::nullopt
+    [[nodiscard]] std::optional<Placement> insert(int w, int h);
+
+    void reset() noexcept {
+        shelves_.clear();
+        next_shelf_y_ = 0;
+    }
+
+    [[nodiscard]] int width() const noexcept { return width_; }
+    [[nodiscard]] int height() const noexcept { return height_; }
+
+   private:
+    struct Shelf {
+        int y;
+        int height;
+        int cursor_x;
+    };
+
+    int width_;
+    int height_;
+    int padding_;
+    int next_shelf_y_ = 0;
+    std::vector<Shelf> shelves_;
+};
+
+/**
+ * GlyphQuad ― アトラス上の 1 グリフと、文字列の左上を原点にした描画位置
+ */
+struct GlyphQuad {
+    float src_x, src_y;
+    float dst_x, dst_y;
+    float width, height;
+};
+
+/**
+ * TextLayout ― 配置済みの文字列（アトラスのどこを、どこに描くか）
+ */
+struct TextLayout {
+    std::vector<GlyphQuad> quads;
+    int width = 0;
+    int height = 0;
+
+    /// キャッシュの予算計算に使う概算のメモリ量
+    [[nodiscard]] std::size_t bytes() const noexcept {
+        return sizeof(TextLayout) + quads.capacity() * sizeof(GlyphQuad);
+    }
+};
+
+/**
+ * 符号位置の列をアトラスのグリフで配置する（GlyphAtlas::layout の本体）
+ *   - Atlas には generation() / line_height() / kerning(previous, code) / glyph(code) が要る。
+ *     glyph は x, y, width, height, advance を持つ値を返し、アトラスが一杯なら作り直してから詰める
+ *   - 改行（U+000A）で次の行に進む
+ *   - 途中でアトラスを作り直したら、それまでの座標は無効なので 1 回だけ最初から並べ直す
+ * @return 配置結果。並べ直しの途中でもう一度作り直した（アトラス 1 枚に収まらない）場合は
+ *         std::nullopt。どちらの場合も呼び出し側は generation() を見て古いレイアウトを捨てること
+ */
+template <typename Atlas>
+std::optional<TextLayout> layout_glyphs(Atlas& atlas, const std::vector<char32_t>& codepoints) {
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        const std::uint32_t generation = atlas.generation();
+        const int line_height = atlas.line_height();
+        TextLayout result;
+        result.quads.reserve(codepoints.size());
+
+        int pen_x = 0;
+        int pen_y = 0;
+        char32_t previous = 0;
+        bool reset = false;
+        for (const char32_t code : codepoints) {
+            if (code == U'\n') {
+                result.width = std::max(result.width, pen_x);
+                pen_x = 0;
+                pen_y += line_height;
+                previous = 0;
+                continue;
+            }
+            if (previous != 0) pen_x += atlas.kerning(previous, code);
+            const auto& g = atlas.glyph(code);
+            if (atlas.generation() != generation) {
+                reset = true;
+                break;
+            }
+            if (g.width > 0 && g.height > 0) {
+                result.quads.push_back(GlyphQuad{
+                    static_cast<float>(g.x), static_cast<float>(g.y), static_cast<float>(pen_x),
+                    static_cast<float>(pen_y), static_cast<float>(g.width),
+                    static_cast<float>(g.height)});
+            }
+            pen_x += g.advance;
+            previous = code;
+        }
+        if (reset) continue;
+
+        result.width = std::max(result.width, pen_x);
+        result.height = pen_y + line_height;
+        return result;
+    }
+    return std::nullopt;
+}
+
+/// TextLayoutCache の統計
+struct TextCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+    std::size_t entries = 0;
+    std::size_t bytes = 0;
+};
+
+/**
+ * TextLayoutCache ― (FontId, 文字列) → TextLayout の LRU キャッシュ
+ *   - 合計メモリ（文字列とレイアウトの概算）が予算を超えたら最も古く使われたものから捨てる
+ *   - 予算より大きい 1 件は保持しない（insert は nullptr を返す）
+ */
+class TextLayoutCache {
+   public:
+    explicit TextLayoutCache(std::size_t budget_bytes = 256 * 1024) noexcept
+        : budget_bytes_(budget_bytes) {}
+
+    /**
+     * キャッシュを引く（ヒットしたら最新として扱う）
+     * @return ヒット時はレイアウト（次の insert / erase_font までは有効）、ミス時は nullptr
+     */
+    [[nodiscard]] const TextLayout* find(FontId font, std::string_view text);
+
+    /**
+     * レイアウトを登録する
+     * @return 登録したレイアウト。予算を超えて保持できない場合は nullptr
+     */
+    const TextLayout* insert(FontId font, std::string_view text, TextLayout layout);
+
+    /// フォントのレイアウトをすべて捨てる（アトラスを作り直したとき）
+    void erase_font(FontId font);
+
+    void clear();
+
+    [[nodiscard]] const TextCacheStats& stats() const noexcept { return stats_; }
+
+   private:
+    struct Entry {
+        std::string text;
+        FontId font;
+        TextLayout layout;
+        std::size_t bytes;
+    };
+    using EntryList = std::list<Entry>;
+
+    /**
+     * 索引のキー。text は Entry::text を指す（リストのノードは動かないので登録中は有効）
+     *   - 引くときは呼び出し側の文字列をそのまま指すので、find は文字列を確保しない
+     */
+    struct Key {
+        FontId font;
+        std::string_view text;
+
+        bool operator==(const Key& other) const noexcept {
+            return font == other.font && text == other.text;
+        }
+    };
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const noexcept;
+    };
+
+    std::size_t budget_bytes_;
+    EntryList entries_;  ///< 先頭が最も新しい
+    std::unordered_map<Key, EntryList::iterator, KeyHash> index_;
+    TextCacheStats stats_;
+
+    void evict_to_budget();
+    void erase(EntryList::iterator it);
+};
+
+#endif /* B6E3F9A1_4D72_4C58_9A1E_7F0C2D8B5A36 */
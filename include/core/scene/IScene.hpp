@@ -5,6 +5,7 @@
 #include <core/IGameState.hpp>
 #include <core/IRenderer.hpp>
 #include <core/Input.hpp>
+#include <core/ResourceManager.hpp>
 #include <memory>
 
 /**
@@ -21,6 +22,16 @@ class IScene {
     // シーンの初期化が必要ならここで行う
     virtual void initialize(const GameConfig& config) = 0;
 
+    /**
+     * リソースの先読み付きの初期化（SceneManager に ResourceManager があるときに呼ばれる）
+     * 既定では initialize(config) を呼ぶ。フォント・テクスチャを使うシーンはここで取得し、
+     * cleanup で返す。render で読み込まないこと
+     */
+    virtual void initialize(const GameConfig& config, ResourceManager& resources) {
+        (void)resources;
+        initialize(config);
+    }
+
     // シーンの更新処理
     virtual void update(const double delta_time) = 0;
 
@@ -30,7 +41,20 @@ class IScene {
     // シーンの描画処理
     virtual void render(IRenderer& renderer) = 0;
 
-    // シーンの終了処理
+    /**
+     * 補間付きの描画処理
+     * @param alpha 最後のロジックティックから次のティックまでの進み具合 [0, 1)
+     * 既定では補間せずに render(renderer) を呼ぶ。動きを滑らかにしたいシーンだけ上書きする
+     */
+    virtual void render(IRenderer& renderer, double alpha) {
+        (void)alpha;
+        render(renderer);
+    }
+
+    /**
+     * シーンの終了処理
+     * 遷移では次のシーンの initialize の後に呼ばれる（共有するリソースを解放させないため）
+     */
     virtual void cleanup() = 0;
 
     virtual std::optional<std::unique_ptr<IScene>> take_scene_transition() = 0;
@@ -2,6 +2,7 @@
 #define D84B2884_6930_4338_8CE4_151D458C1D5E
 
 #include <core/GameConfig.hpp>
+#include <core/StatePool.hpp>
 #include <core/scene/IScene.hpp>
 
 /**
@@ -14,6 +15,9 @@ class InitialScene final : public IScene {
    public:
     void initialize(const GameConfig& config) override;
 
+    /// 描画用のフォントを先読みしてから initialize(config) を行う
+    void initialize(const GameConfig& config, ResourceManager& resources) override;
+
     void update(const double delta_time) override;
 
     void process_input(const Input& input) override;
@@ -25,7 +29,10 @@ class InitialScene final : public IScene {
     std::optional<std::unique_ptr<IScene>> take_scene_transition() override;
 
    private:
-    std::shared_ptr<const Input> last_input_;  // 入力は保持（Immutable）
+    std::optional<Input> last_input_;  // 入力は値で保持
+    ResourceManager* resources_ = nullptr;  ///< 先読みしたリソースの返却先（借用）
+    std::optional<FontId> font_;            ///< 先読みしたフォント
+    std::shared_ptr<StatePool> state_pool_;  ///< 毎フレームの状態の確保先（状態と共有する）
 };
 
 #endif /* D84B2884_6930_4338_8CE4_151D458C1D5E */
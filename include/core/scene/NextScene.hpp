@@ -4,7 +4,8 @@
 #include <core/IGameState.hpp>
 #include <core/scene/IScene.hpp>
 
-class NextSceneGameState : public IGameState {
+class NextSceneGameState : public IGameState,
+                           public std::enable_shared_from_this<NextSceneGameState> {
    public:
     // 状態の初期化や更新処理をここで実装
     NextSceneGameState() = default;
@@ -12,6 +13,8 @@ class NextSceneGameState : public IGameState {
     // 状態の更新処理
     std::shared_ptr<const IGameState> step(const Input& input,
                                            const double delta_time) const override {
+        // 変化する値を持たないので自分自身を返す（shared_ptr で所有されていないときだけ作る）
+        if (auto self = weak_from_this().lock()) return self;
         return std::make_shared<NextSceneGameState>(*this);
     };
 
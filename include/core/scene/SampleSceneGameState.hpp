@@ -6,9 +6,10 @@
 #include <core/IRenderer.hpp>
 #include <core/Input.hpp>
 #include <core/Position.hpp>
-#include <immer/map.hpp>
+#include <core/StatePool.hpp>
+#include <array>
 #include <memory>
-#include <unordered_map>
+#include <optional>
 
 /**
  * SampleSceneGameState ― サンプルシーン用ゲーム状態
@@ -18,13 +19,27 @@
  * - シーン遷移フラグ（transition_flag_）
  *
  * を保持し、`step()` で純粋関数的に次状態を生成する。
+ *   - 何も変わらないフレームは自分自身を返し、新しい状態を作らない
+ *   - 新しい状態はシーンの StatePool から作る。ホールド時間は 4 キー分の固定長配列で持つので、
+ *     定常状態の step はヒープ確保をしない
  */
 
-class SampleSceneGameState final : public IGameState {
+class SampleSceneGameState final : public IGameState,
+                                   public std::enable_shared_from_this<SampleSceneGameState> {
    public:
-    explicit SampleSceneGameState(Position pos = {100, 100});
-    SampleSceneGameState(Position pos, immer::map<InputKey, double> durations,
-                         bool transition_flag);
+    /// 方向キー（UP / DOWN / LEFT / RIGHT）ごとのホールド時間 [s]。添字は InputKey の値
+    using HoldDurations = std::array<double, 4>;
+
+    /**
+     * @param pos 初期位置
+     * @param font ラベルの描画に使う先読み済みのフォント（なければラベルを描かない）
+     * @param pool 次の状態の確保に使うプール（なければ std::make_shared）
+     */
+    explicit SampleSceneGameState(Position pos = {100, 100},
+                                  std::optional<FontId> font = std::nullopt,
+                                  std::shared_ptr<StatePool> pool = nullptr);
+    SampleSceneGameState(Position pos, const HoldDurations& durations, bool transition_flag,
+                         std::optional<FontId> font, std::shared_ptr<StatePool> pool);
 
     [[nodiscard]]
     std::shared_ptr<const IGameState> step(const Input& input, double delta_time) const override;
@@ -35,8 +50,10 @@ class SampleSceneGameState final : public IGameState {
 
    private:
     Position position_;
-    immer::map<InputKey, double> hold_durations_;  // ← immer化
+    HoldDurations hold_durations_;
     bool transition_flag_;
+    std::optional<FontId> font_;  ///< 所有はシーン側（ResourceManager から取得・返却する）
+    std::shared_ptr<StatePool> pool_;
 };
 
 #endif /* F1EA53AA_727E_42B0_901D_CAB3DF235528 */
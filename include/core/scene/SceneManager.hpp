@@ -3,6 +3,7 @@
 #ifndef C79CAE94_BCD1_41D5_AD77_2A43EE576AB7
 #define C79CAE94_BCD1_41D5_AD77_2A43EE576AB7
 #include <core/GameConfig.hpp>
+#include <core/ResourceManager.hpp>
 #include <core/scene/IScene.hpp>
 #include <memory>
 
@@ -13,14 +14,21 @@
 
 class SceneManager {
    public:
+    /**
+     * @param resources シーンに渡すリソース管理（nullptr ならシーンは initialize(config) だけを受ける）
+     */
     SceneManager(std::unique_ptr<IScene> initial_scene,
-                 const std::shared_ptr<const GameConfig>& game_config)
-        : current_scene_{std::move(initial_scene)}, game_config_{game_config} {
-        current_scene_->initialize(*game_config);
+                 const std::shared_ptr<const GameConfig>& game_config,
+                 std::shared_ptr<ResourceManager> resources = nullptr)
+        : current_scene_{std::move(initial_scene)},
+          game_config_{game_config},
+          resources_{std::move(resources)} {
+        initialize_current();
     }
 
     void update(const double delta_time);
     void render(IRenderer& renderer);
+    void render(IRenderer& renderer, double alpha);
     void process_input(const Input& input);
 
     IScene& get_current() const;
@@ -29,9 +37,11 @@ class SceneManager {
     std::unique_ptr<IScene> current_scene_;
     std::unique_ptr<IScene> next_scene_;
     std::shared_ptr<const GameConfig> game_config_;
+    std::shared_ptr<ResourceManager> resources_;
 
     void change_scene(std::unique_ptr<IScene> next);
     void apply_scene_change();
+    void initialize_current();
 };
 
 #endif /* C79CAE94_BCD1_41D5_AD77_2A43EE576AB7 */
@@ -0,0 +1,81 @@
+#ifndef E8C2A5D7_3F91_4B6E_A0D4_5C7B1E9F3A28
+#define E8C2A5D7_3F91_4B6E_A0D4_5C7B1E9F3A28
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <core/render/TextLayout.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tl/expected.hpp>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * GlyphAtlas ― 1 フォント（FontId = フォントファイル × ポイントサイズ）分のグリフアトラス
+ *   - グリフは初めて使われたときに白で 1 回だけラスタライズし、ShelfPacker で 1 枚の
+ *     テクスチャに詰める。色は描画時に頂点色で乗せる
+ *   - layout() は文字列を GlyphQuad の列に変換する。結果は TextLayoutCache に載せて使い回す
+ *   - アトラスが一杯になったら空にして詰め直す。その時点までの GlyphQuad は無効になるので
+ *     generation() が変わったら、このフォントのレイアウトキャッシュを捨てること
+ */
+class GlyphAtlas {
+   public:
+    static constexpr int kDefaultSize = 1024;  ///< CJK の常用字を数百字載せられる大きさ
+
+    /**
+     * アトラスを作る
+     * @param renderer テクスチャを作るレンダラ（借用）
+     * @param font ラスタライズするフォント（借用。アトラスより長く生きること）
+     * @return 成功: アトラス, 失敗: テクスチャを作れない場合のエラーメッセージ
+     */
+    [[nodiscard]] static tl::expected<std::unique_ptr<GlyphAtlas>, std::string> create(
+        SDL_Renderer* renderer, TTF_Font* font, int size = kDefaultSize);
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+    ~GlyphAtlas();
+
+    /**
+     * 文字列を配置する（足りないグリフはここでラスタライズする）
+     *   - 改行（U+000A）で次の行に進む
+     *   - 途中でアトラスを作り直したら 1 回だけ並べ直す（layout_glyphs）
+     * @return 配置結果。並べ直しても収まらない（アトラス 1 枚に載らない）場合は std::nullopt
+     */
+    [[nodiscard]] std::optional<TextLayout> layout(std::string_view utf8);
+
+    /// アトラスを作り直した回数（layout の結果が無効になったかの判定用）
+    [[nodiscard]] std::uint32_t generation() const noexcept { return generation_; }
+
+    [[nodiscard]] SDL_Texture* texture() const noexcept { return texture_; }
+    [[nodiscard]] std::size_t glyph_count() const noexcept { return glyphs_.size(); }
+
+   private:
+    struct Glyph {
+        int x, y;  ///< アトラス上の左上
+        int width, height;
+        int advance;
+    };
+
+    GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font, SDL_Texture* texture, int size) noexcept
+        : renderer_(renderer), font_(font), texture_(texture), packer_(size, size) {}
+
+    SDL_Renderer* renderer_;
+    TTF_Font* font_;
+    SDL_Texture* texture_;
+    ShelfPacker packer_;
+    std::unordered_map<char32_t, Glyph> glyphs_;
+    std::uint32_t generation_ = 0;
+    std::vector<char32_t> codepoints_;  ///< layout の作業領域
+
+    /// グリフを引く。なければラスタライズして詰める（一杯なら reset してから詰める）
+    const Glyph& glyph(char32_t code);
+
+    /// グリフをラスタライズしてアトラスに書き込む。入らなければ std::nullopt
+    std::optional<Glyph> rasterize(char32_t code);
+
+    void reset();
+};
+
+#endif /* E8C2A5D7_3F91_4B6E_A0D4_5C7B1E9F3A28 */
@@ -4,16 +4,20 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <core/IRenderer.hpp>
+#include <core/render/TextLayout.hpp>
 #include <memory>
+#include <sdl/GlyphAtlas.hpp>
 #include <string>
 #include <tl/expected.hpp>
 #include <unordered_map>
+#include <vector>
 
 /**
  * SDLRenderer ― SDL2 バックエンド実装
  *   - RAII で SDL_Renderer を保持
  *   - 生成は static create() から行い、結果を tl::expected で返す
  *   - テクスチャは register_texture() で管理（これも expected で結果返却）
+ *   - テキストはフォントごとの GlyphAtlas と TextLayoutCache から、四角形のまとめ描きで描く
  */
 class SDLRenderer final : public IRenderer {
    public:
@@ -38,6 +42,7 @@ class SDLRenderer final : public IRenderer {
     // フレーム制御 ----------------------------------------------------------
     void begin_frame() override;
     void end_frame() override;
+    bool set_vsync(bool enabled) override;
 
     // 画面クリア ------------------------------------------------------------
     void clear(Color color = {0, 0, 0, 255}) override;
@@ -46,11 +51,26 @@ class SDLRenderer final : public IRenderer {
     void fill_rect(const Rect& rect, Color color) override;    // 塗りつぶし
     void stroke_rect(const Rect& rect, Color color) override;  // 枠線のみ
 
+    /// SDL_RenderGeometry 1 回（頂点色付きの三角形 2 枚 × count）で塗る
+    void fill_rects(const ColoredRect* rects, std::size_t count) override;
+    /// SDL_RenderDrawRects 1 回で描く
+    void stroke_rects(const Rect* rects, std::size_t count, Color color) override;
+
     void draw_line(Position start, Position end, Color color) override;
 
     void draw_texture(TextureId id, const Rect& src_region, const Rect& dst_region,
                       double angle = 0.0) override;
 
+    // オフスクリーン描画 ----------------------------------------------------
+    /// SDL_TEXTUREACCESS_TARGET のテクスチャを作って登録する
+    [[nodiscard]]
+    tl::expected<TextureId, std::string> create_render_target(int width, int height) override;
+    bool set_render_target(std::optional<TextureId> target) override;
+    void release_texture(TextureId id) override;
+    /// BMP を読み込む（SDL_image には依存しない）
+    [[nodiscard]]
+    tl::expected<TextureId, std::string> load_texture(const std::string& path) override;
+
     // ──────────── フォント関連 ------------------------------------------------
     /**
      * フォントをロードして登録
@@ -61,9 +81,12 @@ class SDLRenderer final : public IRenderer {
     [[nodiscard]]
     tl::expected<FontId, std::string> register_font(const std::string& path, int pt_size) override;
 
+    /// フォントを閉じ、そのアトラスと配置キャッシュも捨てる
+    void release_font(FontId id) override;
+
     /**
-     * テキストを即描画
-     *   - キャッシュが必要なら呼び出し側で wrap してください
+     * テキストを描画
+     *   - 配置済みの文字列を LRU でキャッシュし、アトラスから SDL_RenderGeometry 1 回で描く
      * @param font_id 登録済みフォント
      * @param utf8    UTF-8 文字列
      * @param pos     描画左上座標
@@ -82,6 +105,11 @@ class SDLRenderer final : public IRenderer {
     /** BlendMode を直接設定 */
     void set_blend_mode(SDL_BlendMode mode) { SDL_SetRenderDrawBlendMode(renderer_, mode); }
 
+    /** テキスト配置キャッシュのヒット・ミス数と使用量 */
+    [[nodiscard]] const TextCacheStats& text_cache_stats() const noexcept {
+        return layout_cache_.stats();
+    }
+
     /** 外部連携用に生ポインタを公開 */
     SDL_Renderer* raw() noexcept { return renderer_; }
 
@@ -100,8 +128,29 @@ class SDLRenderer final : public IRenderer {
     std::unordered_map<FontId, TTF_Font*> fonts_;
     FontId next_font_id_{0};
 
+    // テキスト描画のキャッシュ（アトラスを作れなかったフォントは毎回 TTF_RenderUTF8 で描く）
+    std::unordered_map<FontId, std::unique_ptr<GlyphAtlas>> atlases_;
+    TextLayoutCache layout_cache_;
+
+    // バッチ描画用の作業領域（毎フレーム使い回し、確保はサイズが増えたときだけ）
+    std::vector<SDL_Vertex> batch_vertices_;
+    std::vector<int> batch_indices_;
+    std::vector<SDL_Rect> batch_rects_;
+
     // 内部ヘルパ ------------------------------------------------------------
     void set_draw_color(Color c) { SDL_SetRenderDrawColor(renderer_, c.r, c.g, c.b, c.a); }
+
+    /**
+     * アトラスの四角形を頂点色つきでまとめて描く
+     * @return 失敗: SDL_RenderGeometry を使えない場合のエラーメッセージ
+     */
+    tl::expected<void, std::string> draw_glyph_quads(const GlyphAtlas& atlas,
+                                                     const TextLayout& layout, Position pos,
+                                                     Color color);
+
+    /// アトラスを使わずに 1 回ごとにラスタライズして描く
+    tl::expected<void, std::string> draw_text_uncached(TTF_Font* font, const std::string& utf8,
+                                                       Position pos, Color color);
 };
 
 #endif /* D17E6D9B_A7F3_4DDC_97F4_93C7522C8A8C */
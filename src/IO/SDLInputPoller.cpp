@@ -1,17 +1,14 @@
 #include <IO/KeyMapping.hpp>
 #include <IO/SDLInputPoller.hpp>
 
-std::shared_ptr<const Input> SDLInputPoller::poll(std::shared_ptr<const Input> previous_input) {
-    auto input = std::make_shared<Input>(*previous_input);  // コピーして操作対象にする
-    for (auto& [_, state] : input->key_states) {
-        state.is_pressed = false;
-        state.is_released = false;
-    }
+Input SDLInputPoller::poll(const Input& previous_input) {
+    // held だけ引き継いだ値を操作対象にする（ヒープ確保なし）
+    Input input = previous_input.clear_frame_state();
 
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         if (event.type == SDL_QUIT) {
-            input->key_states[InputKey::QUIT].is_pressed = true;
+            input.pressed |= Input::bit_of(InputKey::QUIT);
             continue;
         }
 
@@ -21,14 +18,11 @@ std::shared_ptr<const Input> SDLInputPoller::poll(std::shared_ptr<const Input> p
         if (!maybe_key.has_value()) continue;
 
         InputKey key = maybe_key.value();
-        InputState& state = input->key_states[key];
 
         if (event.type == SDL_KEYDOWN) {
-            if (!state.is_held) state.is_pressed = true;
-            state.is_held = true;
+            input.key_down(key);
         } else {
-            state.is_held = false;
-            state.is_released = true;
+            input.key_up(key);
         }
     }
 
@@ -0,0 +1,22 @@
+#include <algorithm>
+#include <cmath>
+#include <core/FixedStepDriver.hpp>
+
+FrameSteps FixedStepDriver::advance(double elapsed_seconds) noexcept {
+    // NaN・負値は 0、巨大な dt は上限で切る
+    if (!(elapsed_seconds > 0.0)) elapsed_seconds = 0.0;
+    this->accumulator_ += std::min(elapsed_seconds, timestep::kMaxFrameSeconds);
+
+    int steps = 0;
+    while (this->accumulator_ >= this->step_seconds_ && steps < this->max_steps_per_frame_) {
+        this->accumulator_ -= this->step_seconds_;
+        ++steps;
+    }
+    // 上限まで回しても残った遅れは捨てる（位相だけ残す）
+    if (this->accumulator_ >= this->step_seconds_) {
+        this->accumulator_ = std::fmod(this->accumulator_, this->step_seconds_);
+    }
+
+    this->total_steps_ += static_cast<std::uint64_t>(steps);
+    return FrameSteps{steps, this->accumulator_ / this->step_seconds_};
+}
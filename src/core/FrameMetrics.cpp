@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <core/FrameMetrics.hpp>
+
+void LatencyHistogram::record(std::uint64_t micros) noexcept {
+    this->buckets_[bucket_of(micros)].fetch_add(1, std::memory_order_relaxed);
+    this->count_.fetch_add(1, std::memory_order_relaxed);
+    this->sum_.fetch_add(micros, std::memory_order_relaxed);
+
+    std::uint64_t seen = this->max_.load(std::memory_order_relaxed);
+    while (micros > seen &&
+           !this->max_.compare_exchange_weak(seen, micros, std::memory_order_relaxed)) {
+    }
+}
+
+PhaseSummary LatencyHistogram::summarize() const noexcept {
+    // 記録と並行して読むので、各バケットの合計から件数を数え直してから分位点を取る
+    std::array<std::uint32_t, kBucketCount> snapshot{};
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        snapshot[i] = this->buckets_[i].load(std::memory_order_relaxed);
+        total += snapshot[i];
+    }
+
+    const std::uint64_t max_us = this->max_.load(std::memory_order_relaxed);
+    PhaseSummary summary{total, 0.0, 0, 0, max_us};
+    if (total == 0) return summary;
+
+    const std::uint64_t count = this->count_.load(std::memory_order_relaxed);
+    if (count > 0) {
+        summary.mean_us = static_cast<double>(this->sum_.load(std::memory_order_relaxed)) /
+                          static_cast<double>(count);
+    }
+
+    // rank 番目（1 始まり）の値が入るバケットの上端。最大値を超えないように丸める
+    const auto value_at_rank = [&](std::uint64_t rank) {
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            seen += snapshot[i];
+            if (seen >= rank) return std::min(upper_bound_of(i), max_us);
+        }
+        return max_us;
+    };
+    summary.p50_us = value_at_rank((total + 1) / 2);
+    summary.p99_us = value_at_rank((total * 99 + 99) / 100);
+    return summary;
+}
+
+void LatencyHistogram::reset() noexcept {
+    for (auto& bucket : this->buckets_) bucket.store(0, std::memory_order_relaxed);
+    this->count_.store(0, std::memory_order_relaxed);
+    this->sum_.store(0, std::memory_order_relaxed);
+    this->max_.store(0, std::memory_order_relaxed);
+}
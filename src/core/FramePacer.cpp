@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <cmath>
+#include <core/FramePacer.hpp>
+#include <thread>
+
+double FrameTimeStats::stddev_ms() const noexcept { return std::sqrt(variance_ms2()); }
+
+std::chrono::microseconds frame_pacing::wait_until(Clock::time_point deadline,
+                                                   std::chrono::microseconds spin_threshold) {
+    using std::chrono::microseconds;
+
+    // OS のスリープは粒度ぶん遅れて起きることがあるので、締め切りの手前までだけ眠る
+    const Clock::time_point sleep_until = deadline - spin_threshold;
+    microseconds oversleep{0};
+    if (Clock::now() < sleep_until) {
+        std::this_thread::sleep_until(sleep_until);
+        oversleep = std::chrono::duration_cast<microseconds>(Clock::now() - sleep_until);
+    }
+
+    // 残りはビジーウェイトで締め切りちょうどに合わせる（yield すると再スケジュール待ちで遅れる）
+    while (Clock::now() < deadline) {
+    }
+    return oversleep;
+}
+
+FramePacer::FramePacer(PacingMode mode, double target_fps,
+                       std::chrono::microseconds spin_threshold) noexcept
+    : mode_(mode),
+      target_fps_(target_fps),
+      spin_threshold_(spin_threshold),
+      period_{},
+      deadline_(frame_pacing::Clock::now()),
+      last_frame_(deadline_),
+      adaptive_spin_(spin_threshold) {
+    this->set_target_fps(target_fps);
+}
+
+std::chrono::microseconds FramePacer::spin_cap() const noexcept {
+    using namespace std::chrono;
+    const auto half_period = duration_cast<microseconds>(this->period_) / 2;
+    return std::min(frame_pacing::kMaxSpinThreshold, half_period);
+}
+
+void FramePacer::set_mode(PacingMode mode) noexcept {
+    this->mode_ = mode;
+    this->deadline_ = frame_pacing::Clock::now() + this->period_;
+}
+
+void FramePacer::set_target_fps(double target_fps) noexcept {
+    using namespace std::chrono;
+    this->target_fps_ = target_fps > 0.0 ? target_fps : 60.0;
+    this->period_ = duration_cast<frame_pacing::Clock::duration>(
+        duration<double>(1.0 / this->target_fps_));
+    this->deadline_ = frame_pacing::Clock::now() + this->period_;
+    this->adaptive_spin_ = std::min(this->adaptive_spin_, this->spin_cap());
+}
+
+void FramePacer::adapt_spin_threshold() noexcept {
+    using namespace std::chrono;
+    const double margin_ms = this->oversleep_.mean_ms + 3.0 * this->oversleep_.stddev_ms();
+    const auto margin = duration_cast<microseconds>(duration<double, std::milli>(margin_ms));
+    this->adaptive_spin_ = std::min(std::max(this->spin_threshold_, margin), this->spin_cap());
+}
+
+double FramePacer::wait_for_next_frame() {
+    using frame_pacing::Clock;
+
+    if (this->mode_ == PacingMode::TARGET_FPS) {
+        const auto oversleep = frame_pacing::wait_until(this->deadline_, this->adaptive_spin_);
+        if (oversleep.count() > 0) {
+            this->oversleep_.add(static_cast<double>(oversleep.count()) / 1000.0);
+            this->adapt_spin_threshold();
+        }
+        const Clock::time_point now = Clock::now();
+        this->deadline_ += this->period_;
+        // 1 周期以上遅れていたら締め切りを合わせ直す（連続で待たないフレームを出さない）
+        if (this->deadline_ <= now) this->deadline_ = now + this->period_;
+    }
+
+    const Clock::time_point now = Clock::now();
+    const double elapsed = std::chrono::duration<double>(now - this->last_frame_).count();
+    this->last_frame_ = now;
+    this->stats_.add(elapsed * 1000.0);
+    return elapsed;
+}
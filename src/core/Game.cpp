@@ -1,52 +1,102 @@
 #include <chrono>
 #include <cmath>  // for std::max
 #include <core/Game.hpp>
+#include <core/Trace.hpp>
 #include <thread>
 #ifndef __EMSCRIPTEN__
 #include <SDL2/SDL.h>
 #endif
+#if TETRIS_FRAME_METRICS
 #include <iostream>
+#endif
 
 void Game::update(double delta_time) { this->scene_manager_->update(delta_time); }
 void Game::processInput() {
-    // SDLInputPoller で新しい Input を取得（不変）
+    // SDLInputPoller で新しい Input を取得（値のコピーのみ）
     this->current_input_ = input_poller_->poll(this->current_input_);
-    // シーンに渡すときは const Input& に展開
-    this->scene_manager_->process_input(*this->current_input_);
+    // ティックが回らないフレームの押下も次のティックに届くよう溜めておく
+    this->pending_input_ = this->pending_input_.accumulate(this->current_input_);
+    if (this->current_input_.is_pressed(InputKey::QUIT)) this->quit_requested_ = true;
 }
 
 // ─────────────────────── 1フレーム処理 ───────────────────────
 void Game::tick(double deltaTime) {
-    this->processInput();     // 入力収集
-    this->update(deltaTime);  // ロジック更新
+    TRACE_SCOPE("frame", "Game::tick");
+    TETRIS_FRAME_PHASE(this->frame_metrics_, FramePhase::FRAME);
+    {
+        TETRIS_FRAME_PHASE(this->frame_metrics_, FramePhase::INPUT);
+        TRACE_SCOPE("frame", "Game::processInput");
+        this->processInput();  // 入力収集
+    }
+
+    // ロジック更新は固定ティックで。押した瞬間・離した瞬間は最初のティックだけに渡す
+    double alpha = 0.0;
+    {
+        TETRIS_FRAME_PHASE(this->frame_metrics_, FramePhase::UPDATE);
+        TRACE_SCOPE("frame", "Game::update");
+        const FrameSteps frame = this->step_driver_.advance(deltaTime);
+        for (int i = 0; i < frame.steps; ++i) {
+            this->scene_manager_->process_input(this->pending_input_);
+            this->update(this->step_driver_.step_seconds());
+            this->pending_input_ = this->pending_input_.clear_frame_state();
+        }
+        alpha = frame.alpha;
+    }
 
     // レンダリング処理
-    renderer_->begin_frame();          // ← 任意（状態リセット用）
-    renderer_->clear({0, 0, 0, 255});  // 背景を真っ黒でクリア (任意)
-    this->scene_manager_->render(*renderer_);
-    renderer_->end_frame();  // ← SDL_RenderPresent() が呼ばれる
+    {
+        TETRIS_FRAME_PHASE(this->frame_metrics_, FramePhase::BEGIN_FRAME);
+        renderer_->begin_frame();  // ← 任意（状態リセット用）
+    }
+    {
+        TETRIS_FRAME_PHASE(this->frame_metrics_, FramePhase::CLEAR);
+        renderer_->clear({0, 0, 0, 255});  // 背景を真っ黒でクリア (任意)
+    }
+    {
+        TETRIS_FRAME_PHASE(this->frame_metrics_, FramePhase::RENDER);
+        TRACE_SCOPE("frame", "SceneManager::render");
+        this->scene_manager_->render(*renderer_, alpha);
+    }
+    {
+        TETRIS_FRAME_PHASE(this->frame_metrics_, FramePhase::END_FRAME);
+        renderer_->end_frame();  // ← SDL_RenderPresent() が呼ばれる（垂直同期の待ちを含む）
+    }
+}
+
+PacingMode Game::set_pacing_mode(PacingMode mode) {
+    const bool vsync = mode == PacingMode::VSYNC;
+    if (!this->renderer_->set_vsync(vsync) && vsync) {
+        // 垂直同期を使えないバックエンドでは目標フレームレートで待つ
+        mode = PacingMode::TARGET_FPS;
+    }
+    this->pacer_.set_target_fps(this->config_->frame_rate.frame_rate);
+    this->pacer_.set_mode(mode);
+    return mode;
 }
 
 // ─────────────────────── デスクトップ専用ループ ───────────────
 #ifndef __EMSCRIPTEN__
 void Game::runLoop() {
-    using clock = std::chrono::steady_clock;
-
-    const double target = 1.0 / static_cast<double>(config_.frame_rate.frame_rate);
-    auto last = clock::now();
+    // 待ち方は FramePacer に任せる（TARGET_FPS では sleep + spin で締め切りに合わせる）
+    this->set_pacing_mode(this->pacer_.mode());
+    this->pacer_.reset_stats();
 
-    while (true) {
-        auto now = clock::now();
-        double dt = std::chrono::duration<double>(now - last).count();
-        last = now;
-
-        tick(dt);
+    while (!this->quit_requested_) {
+        tick(this->pacer_.wait_for_next_frame());
+    }
 
-        // 経過時間を測って不足分だけスリープ
-        double spent = std::chrono::duration<double>(clock::now() - now).count();
-        double remaining = target - spent;
-        if (remaining > 0.0)
-            SDL_Delay(static_cast<Uint32>(remaining * 1000.0));  // 高分解能ではないが十分
+#if TETRIS_FRAME_METRICS
+    // 計測ビルドでだけ終了時に統計を出す（通常ビルドは何も出力しない）
+    const FrameTimeStats& stats = this->pacer_.stats();
+    std::cout << "frames: " << stats.count << ", frame time mean " << stats.mean_ms
+              << " ms, jitter (stddev) " << stats.stddev_ms() << " ms, min " << stats.min_ms
+              << " ms, max " << stats.max_ms << " ms" << std::endl;
+    for (std::size_t i = 0; i < kFramePhaseCount; ++i) {
+        const auto phase = static_cast<FramePhase>(i);
+        const PhaseSummary summary = this->frame_metrics_.summary(phase);
+        std::cout << "  " << to_string(phase) << ": p50 " << summary.p50_us << " us, p99 "
+                  << summary.p99_us << " us, max " << summary.max_us << " us" << std::endl;
     }
+#endif
 }
 #endif
@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <atomic>
+#include <core/GameFarm.hpp>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <thread>
+
+namespace {
+/**
+ * ワーカーごとに割り当てたチャンク番号の半開区間 [head, tail)
+ *   - head（下位 32 ビット）と tail（上位 32 ビット）を 1 つの atomic に詰め、CAS で取り出す。
+ *     ロックは使わない
+ *   - 持ち主は末尾から取り出し、他のワーカーは先頭から盗む。盗みと重ならない限り持ち主は
+ *     1 回の CAS で取り出せ、キャッシュラインも自分のコアに載ったまま
+ *   - ジョブは run() の先頭で配り終え、途中で増えない。区間は縮む一方
+ *   - 隣のワーカーの区間とキャッシュラインを共有しないよう揃える
+ */
+struct alignas(64) WorkerRange {
+    std::atomic<std::uint64_t> packed{0};
+};
+
+constexpr std::uint64_t pack(std::uint32_t head, std::uint32_t tail) {
+    return (std::uint64_t{tail} << 32) | head;
+}
+
+// 区間が守るのはチャンク番号だけ。ジョブはスレッドの起動前に書き終え、結果は join で受け渡すので
+// relaxed でよい（取り合いの排他は CAS そのものが保証する）
+
+std::optional<std::uint32_t> pop_own(WorkerRange& range) {
+    std::uint64_t packed = range.packed.load(std::memory_order_relaxed);
+    for (;;) {
+        const auto head = static_cast<std::uint32_t>(packed);
+        const auto tail = static_cast<std::uint32_t>(packed >> 32);
+        if (head == tail) return std::nullopt;
+        if (range.packed.compare_exchange_weak(packed, pack(head, tail - 1),
+                                               std::memory_order_relaxed)) {
+            return tail - 1;
+        }
+    }
+}
+
+std::optional<std::uint32_t> steal(WorkerRange& range) {
+    std::uint64_t packed = range.packed.load(std::memory_order_relaxed);
+    for (;;) {
+        const auto head = static_cast<std::uint32_t>(packed);
+        const auto tail = static_cast<std::uint32_t>(packed >> 32);
+        if (head == tail) return std::nullopt;
+        if (range.packed.compare_exchange_weak(packed, pack(head + 1, tail),
+                                               std::memory_order_relaxed)) {
+            return head;
+        }
+    }
+}
+
+GameResult play(const GameConfig& config, const GameJob& job,
+                const GameFarm::PolicyFactory& policy_factory) {
+    // 設定は run() の先頭で検証済み
+    auto simulation = TetrisSimulation::create(config, job.seed).value();
+    GameFarm::Policy policy = policy_factory(job.seed);
+    while (!simulation.is_game_over() && simulation.tick_count() < job.max_ticks) {
+        simulation.step(policy(simulation));
+    }
+    return GameResult{job.seed, simulation.lines_cleared(), simulation.pieces_locked(),
+                      simulation.tick_count(), simulation.is_game_over()};
+}
+}  // namespace
+
+GameFarm::GameFarm(unsigned threads, std::size_t chunk_size)
+    : threads_(threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency())),
+      chunk_size_(std::max<std::size_t>(1, chunk_size)) {}
+
+tl::expected<FarmSummary, std::string> GameFarm::run(const GameConfig& config,
+                                                     const std::vector<GameJob>& jobs,
+                                                     const PolicyFactory& policy_factory) const {
+    if (auto probe = TetrisSimulation::create(config, 0); !probe) {
+        return tl::unexpected<std::string>{"GameFarm::run: " + probe.error()};
+    }
+
+    std::vector<GameResult> results(jobs.size());
+    const std::size_t chunks = (jobs.size() + chunk_size_ - 1) / chunk_size_;
+    if (chunks > std::numeric_limits<std::uint32_t>::max()) {
+        return tl::unexpected<std::string>{"GameFarm::run: too many chunks"};
+    }
+    const unsigned workers =
+        static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threads_, chunks)));
+
+    // チャンク番号を連続した区間に分けて各ワーカーへ配る（チャンク数はジョブ数より多くならない）
+    auto ranges = std::make_unique<WorkerRange[]>(workers);
+    for (unsigned w = 0; w < workers; ++w) {
+        const auto head = static_cast<std::uint32_t>(chunks * w / workers);
+        const auto tail = static_cast<std::uint32_t>(chunks * (w + 1) / workers);
+        ranges[w].packed.store(pack(head, tail), std::memory_order_relaxed);
+    }
+
+    // 統計は自分の要素にだけ書くので、ワーカー間で共有しない
+    std::vector<WorkerStats> stats(workers, WorkerStats{0, 0});
+    auto worker_main = [&](unsigned self) {
+        WorkerStats& mine = stats[self];
+        for (;;) {
+            std::optional<std::uint32_t> chunk = pop_own(ranges[self]);
+            for (unsigned k = 1; !chunk && k < workers; ++k) {
+                chunk = steal(ranges[(self + k) % workers]);
+                if (chunk) ++mine.stolen_chunks;
+            }
+            // ジョブは途中で増えないので、全区間が空なら終了してよい
+            if (!chunk) break;
+            const std::size_t begin = *chunk * chunk_size_;
+            const std::size_t end = std::min(jobs.size(), begin + chunk_size_);
+            for (std::size_t i = begin; i < end; ++i) {
+                results[i] = play(config, jobs[i], policy_factory);
+            }
+            mine.games += end - begin;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (unsigned w = 1; w < workers; ++w) threads.emplace_back(worker_main, w);
+    worker_main(0);  // 呼び出しスレッドもワーカー 0 として働く
+    for (auto& thread : threads) thread.join();
+
+    // ジョブ順に集計する（スケジュールに依存しない）
+    FarmSummary summary{std::move(results), 0, 0, 0, 0, std::move(stats)};
+    for (const GameResult& result : summary.results) {
+        summary.total_lines += static_cast<std::uint64_t>(result.lines_cleared);
+        summary.total_pieces += static_cast<std::uint64_t>(result.pieces_locked);
+        summary.total_ticks += result.ticks;
+        if (result.topped_out) ++summary.topped_out_games;
+    }
+    return summary;
+}
@@ -0,0 +1,63 @@
+#include <core/ResourceManager.hpp>
+#include <core/Trace.hpp>
+
+tl::expected<FontId, std::string> ResourceManager::acquire_font(const std::string& path,
+                                                                int pt_size) {
+    FontKey key{path, pt_size};
+    if (auto it = this->fonts_.find(key); it != this->fonts_.end()) {
+        ++it->second.references;
+        return it->second.id;
+    }
+
+    TRACE_SCOPE("resource", "ResourceManager::load_font");
+    auto loaded = this->renderer_.register_font(path, pt_size);
+    if (!loaded) return tl::unexpected(loaded.error());
+    ++this->loads_;
+    this->font_keys_.emplace(*loaded, key);
+    this->fonts_.emplace(std::move(key), Entry<FontId>{*loaded, 1});
+    return *loaded;
+}
+
+void ResourceManager::release_font(FontId id) {
+    const auto key = this->font_keys_.find(id);
+    if (key == this->font_keys_.end()) return;
+    auto entry = this->fonts_.find(key->second);
+    if (--entry->second.references > 0) return;
+
+    this->renderer_.release_font(id);
+    this->fonts_.erase(entry);
+    this->font_keys_.erase(key);
+}
+
+tl::expected<TextureId, std::string> ResourceManager::acquire_texture(const std::string& path) {
+    if (auto it = this->textures_.find(path); it != this->textures_.end()) {
+        ++it->second.references;
+        return it->second.id;
+    }
+
+    TRACE_SCOPE("resource", "ResourceManager::load_texture");
+    auto loaded = this->renderer_.load_texture(path);
+    if (!loaded) return tl::unexpected(loaded.error());
+    ++this->loads_;
+    this->texture_keys_.emplace(*loaded, path);
+    this->textures_.emplace(path, Entry<TextureId>{*loaded, 1});
+    return *loaded;
+}
+
+void ResourceManager::release_texture(TextureId id) {
+    const auto key = this->texture_keys_.find(id);
+    if (key == this->texture_keys_.end()) return;
+    auto entry = this->textures_.find(key->second);
+    if (--entry->second.references > 0) return;
+
+    this->renderer_.release_texture(id);
+    this->textures_.erase(entry);
+    this->texture_keys_.erase(key);
+}
+
+int ResourceManager::font_references(FontId id) const noexcept {
+    const auto key = this->font_keys_.find(id);
+    if (key == this->font_keys_.end()) return 0;
+    const auto entry = this->fonts_.find(key->second);
+    return entry == this->fonts_.end() ? 0 : entry->second.references;
+}
@@ -0,0 +1,37 @@
+#include <core/StatePool.hpp>
+#include <new>
+
+StatePool::~StatePool() {
+    for (FreeBlock* head : this->free_) {
+        while (head) {
+            FreeBlock* next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+    }
+}
+
+void* StatePool::allocate(std::size_t bytes) {
+    const std::size_t index = class_of(bytes);
+    if (index == kClassCount) return ::operator new(bytes);
+
+    if (FreeBlock* block = this->free_[index]) {
+        this->free_[index] = block->next;
+        ++this->reused_;
+        return block;
+    }
+    ++this->heap_allocations_;
+    return ::operator new((index + 1) * kGranularity);
+}
+
+void StatePool::deallocate(void* block, std::size_t bytes) noexcept {
+    if (!block) return;
+    const std::size_t index = class_of(bytes);
+    if (index == kClassCount) {
+        ::operator delete(block);
+        return;
+    }
+    auto* node = static_cast<FreeBlock*>(block);
+    node->next = this->free_[index];
+    this->free_[index] = node;
+}
@@ -1,7 +1,76 @@
 #include <core/TetrisGrid.hpp>
+#include <vector>
+
+// 設定から空のグリッドを生成
+template <typename MemoryPolicy>
+tl::expected<BasicTetrisGrid<MemoryPolicy>, std::string> BasicTetrisGrid<MemoryPolicy>::create(
+    std::string id, const GameConfig& config) {
+    const GridColumnRow grid_size{config.grid.columns, config.grid.rows};
+    if (grid_size.column <= 0 || grid_size.column > grid_bitboard::kMaxColumns ||
+        grid_size.row <= 0 || grid_size.row > grid_bitboard::kMaxRows) {
+        return tl::unexpected<std::string>{"TetrisGrid::create: grid size is out of range"};
+    }
+
+    const CellFactory factory{config};
+    const Position origin{static_cast<double>(config.game_area_position.x),
+                          static_cast<double>(config.game_area_position.y)};
+    const Size size{grid_size.column * factory.size.width, grid_size.row * factory.size.height};
+    auto cells = initialize_cells(grid_size);
+    return BasicTetrisGrid{std::move(id), origin, size, grid_size, factory, std::move(cells),
+                           GridBitboard::empty(grid_size.column, grid_size.row)};
+}
+
+// 保存済みの状態・色と、行・列から求めた座標で Cell を組み立てる
+template <typename MemoryPolicy>
+Cell BasicTetrisGrid<MemoryPolicy>::cell_at(const GridColumnRow& grid_position) const {
+    const PackedCell packed = this->cells[grid_position.row][grid_position.column];
+    return this->cell_factory.create(
+        get_position_of_cell(grid_position, this->cell_factory.size.width), packed.status(),
+        packed.color());
+}
+
+template <typename MemoryPolicy>
+void BasicTetrisGrid<MemoryPolicy>::render(IRenderer& renderer) const {
+    this->render_rows(renderer, this->all_rows(), this->position);
+}
+
+template <typename MemoryPolicy>
+void BasicTetrisGrid<MemoryPolicy>::render_rows(IRenderer& renderer, RowMask rows,
+                                                Position origin) const {
+    // 座標・サイズは保存していないので行・列から復元する。
+    // 作業領域はスレッドごとのヒープに取って使い回す（Emscripten の小さいスタックを圧迫しない）
+    thread_local std::vector<ColoredRect> fills;
+    thread_local std::vector<Rect> strokes;
+    const auto cell_count = static_cast<std::size_t>(this->grid_size.row * this->grid_size.column);
+    if (fills.size() < cell_count) fills.resize(cell_count);
+    if (strokes.size() < cell_count) strokes.resize(cell_count);
+    std::size_t fill_count = 0;
+    std::size_t stroke_count = 0;
+
+    const double cell_size = this->cell_factory.size.width;
+    for (int row = 0; row < this->grid_size.row; ++row) {
+        if ((rows & (RowMask{1} << row)) == 0) continue;
+        const PackedRow& packed_row = this->cells[row];
+        for (int column = 0; column < this->grid_size.column; ++column) {
+            const PackedCell packed = packed_row[column];
+            const Rect rect{Position{origin.x + column * cell_size, origin.y + row * cell_size},
+                            this->cell_factory.size};
+            if (packed.status() == CellStatus::FILLED) {
+                fills[fill_count++] = ColoredRect{rect, packed.color()};
+            } else {
+                strokes[stroke_count++] = rect;
+            }
+        }
+    }
+
+    renderer.fill_rects(fills.data(), fill_count);
+    renderer.stroke_rects(strokes.data(), stroke_count, colors::kBlack);
+}
 
 // セルの座標を算出
-Position TetrisGrid::get_position_of_cell(const GridColumnRow& grid_position, double cell_size) {
+template <typename MemoryPolicy>
+Position BasicTetrisGrid<MemoryPolicy>::get_position_of_cell(const GridColumnRow& grid_position,
+                                                            double cell_size) const {
     return Position{
         this->position.x + grid_position.column * cell_size,
         this->position.y + grid_position.row * cell_size,
@@ -9,81 +78,175 @@ Position TetrisGrid::get_position_of_cell(const GridColumnRow& grid_position, do
 }
 
 // 座標からグリッド上の行・列を逆算（浮動小数をintに切り下げ）
-GridColumnRow TetrisGrid::get_grid_position_of_cell(const Position& cell_position,
-                                                    double cell_size) {
+template <typename MemoryPolicy>
+GridColumnRow BasicTetrisGrid<MemoryPolicy>::get_grid_position_of_cell(
+    const Position& cell_position, double cell_size) const {
     int col = static_cast<int>((cell_position.x - this->position.x) / cell_size);
     int row = static_cast<int>((cell_position.y - this->position.y) / cell_size);
     return GridColumnRow{col, row};
 }
 
 // 範囲内チェック（整数インデックス）
-bool TetrisGrid::is_within_bounds(int column, int row) {
-    return column >= 0 && column < this->grid_size.column && row >= 0 && row < this->grid_size.row;
+template <typename MemoryPolicy>
+bool BasicTetrisGrid<MemoryPolicy>::is_within_bounds(int column, int row) const {
+    return this->occupancy.contains(column, row);
 }
 
 // 範囲内チェック（座標位置）
-bool TetrisGrid::is_within_bounds(const Position& position) {
+template <typename MemoryPolicy>
+bool BasicTetrisGrid<MemoryPolicy>::is_within_bounds(const Position& position) const {
     return position.x >= this->position.x && position.y >= this->position.y &&
            position.x < this->position.x + this->size.width &&
            position.y < this->position.y + this->size.height;
 }
 
-// セルがFILLED状態か確認
-bool TetrisGrid::is_filled_cell(const GridColumnRow& grid_position) const {
-    int col = grid_position.column;
-    int row = grid_position.row;
-    if (!((col >= 0 && col < this->grid_size.column) && (row >= 0 && row < this->grid_size.row))) {
-        return false;
-    }
-    return this->cells[row][col].type == CellStatus::FILLED;
+// セルがFILLED状態か確認（範囲外は false）
+template <typename MemoryPolicy>
+bool BasicTetrisGrid<MemoryPolicy>::is_filled_cell(const GridColumnRow& grid_position) const {
+    return this->occupancy.is_filled(grid_position.column, grid_position.row);
+}
+
+template <typename MemoryPolicy>
+bool BasicTetrisGrid<MemoryPolicy>::is_colliding(const GridColumnRow& before,
+                                                 const GridColumnRow& after) const {
+    // 領域外への移動は衝突とみなす。盤面外は壁・床の番兵ビットで占有扱いになっている。
+    // EMPTY から EMPTY への移動だけが衝突しない
+    return this->occupancy.is_blocked(before.column, before.row) ||
+           this->occupancy.is_blocked(after.column, after.row);
 }
 
-bool TetrisGrid::is_colliding(const GridColumnRow& before, const GridColumnRow& after) const {
-    // まず両方の位置がグリッド内に収まっているか確認
-    bool before_in_bounds = before.column >= 0 && before.column < grid_size.column &&
-                            before.row >= 0 && before.row < grid_size.row;
-    bool after_in_bounds = after.column >= 0 && after.column < grid_size.column && after.row >= 0 &&
-                           after.row < grid_size.row;
+template <typename MemoryPolicy>
+bool BasicTetrisGrid<MemoryPolicy>::can_place(const Tetrimino& tetrimino) const noexcept {
+    const GridColumnRow origin = tetrimino::origin_of(tetrimino);
+    return !this->occupancy.overlaps(tetrimino::row_masks_of(tetrimino.type, tetrimino.rot),
+                                     origin.column, origin.row);
+}
 
-    if (!(before_in_bounds && after_in_bounds)) {
-        return true;  // 領域外への移動は衝突とみなす
+template <typename MemoryPolicy>
+MoveAvailability BasicTetrisGrid<MemoryPolicy>::probe_moves(
+    const Tetrimino& tetrimino) const noexcept {
+    const GridColumnRow origin = tetrimino::origin_of(tetrimino);
+    const auto& masks = tetrimino::row_masks_of(tetrimino.type, tetrimino.rot);
+
+    return MoveAvailability{
+        !this->occupancy.overlaps(masks, origin.column - 1, origin.row),
+        !this->occupancy.overlaps(masks, origin.column + 1, origin.row),
+        !this->occupancy.overlaps(masks, origin.column, origin.row + 1),
+        this->try_rotate(tetrimino, tetrimino::RotationDirection::CW).has_value(),
+    };
+}
+
+template <typename MemoryPolicy>
+std::optional<Tetrimino> BasicTetrisGrid<MemoryPolicy>::try_rotate(
+    const Tetrimino& tetrimino, tetrimino::RotationDirection dir) const noexcept {
+    const GridColumnRow origin = tetrimino::origin_of(tetrimino);
+    const Tetrimino rotated = tetrimino::rotate(tetrimino, dir);
+    const auto& masks = tetrimino::row_masks_of(rotated.type, rotated.rot);
+
+    for (const GridColumnRow& kick : tetrimino::wall_kicks_of(tetrimino.type, tetrimino.rot, dir)) {
+        if (!this->occupancy.overlaps(masks, origin.column + kick.column, origin.row + kick.row)) {
+            return tetrimino::move(rotated, kick.column, kick.row);
+        }
     }
+    return std::nullopt;
+}
 
-    // セルの状態を取得
-    const CellStatus from_status = cells[before.row][before.column].type;
-    const CellStatus to_status = cells[after.row][after.column].type;
+template <typename MemoryPolicy>
+int BasicTetrisGrid<MemoryPolicy>::drop_distance(const Tetrimino& tetrimino) const noexcept {
+    const GridColumnRow origin = tetrimino::origin_of(tetrimino);
+    const auto& shape = tetrimino::shape_data_of(tetrimino.type, tetrimino.rot);
+    return this->occupancy.drop_distance(shape.bottom, shape.rows, origin.column, origin.row);
+}
 
-    // EMPTY から EMPTY への移動だけが衝突しない
-    if (from_status == CellStatus::EMPTY && to_status == CellStatus::EMPTY) {
-        return false;  // 非衝突
-    }
+template <typename MemoryPolicy>
+Tetrimino BasicTetrisGrid<MemoryPolicy>::landing_position(
+    const Tetrimino& tetrimino) const noexcept {
+    return tetrimino::move(tetrimino, 0, this->drop_distance(tetrimino));
+}
 
-    return true;  // それ以外は衝突扱い
+template <typename MemoryPolicy>
+tl::expected<BasicTetrisGrid<MemoryPolicy>, std::string>
+BasicTetrisGrid<MemoryPolicy>::update_cell(const GridColumnRow& pos, CellStatus status,
+                                           Color color) const {
+    return this->update_cells({CellUpdate{pos, status, color}});
 }
 
-TetrisGrid TetrisGrid::update_cell(const GridColumnRow& pos, CellStatus status, Color color) const {
-    if (pos.row < 0 || pos.row >= this->grid_size.row || pos.column < 0 ||
-        pos.column >= this->grid_size.column) {
-        return *this;  // 範囲外 → 変更なし
+template <typename MemoryPolicy>
+tl::expected<BasicTetrisGrid<MemoryPolicy>, std::string>
+BasicTetrisGrid<MemoryPolicy>::update_cells(const CellUpdate* updates, std::size_t count) const {
+    if (count == 0) return *this;
+
+    // 途中で失敗しても元の盤面には触れていないので、そのままエラーを返せば原子的になる
+    auto rows = this->cells.transient();
+    GridBitboard board = this->occupancy;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const CellUpdate& update = updates[i];
+        const GridColumnRow& pos = update.position;
+        if (!board.contains(pos.column, pos.row)) {
+            return tl::unexpected<std::string>{"update_cells: position out of range"};
+        }
+
+        PackedRow row = rows[pos.row];
+        if (!is_legal_transition(row[pos.column].status(), update.status)) {
+            return tl::unexpected<std::string>{"update_cells: illegal state transition"};
+        }
+
+        // EMPTY → 常に白。それ以外はパレットにある色だけを保存できる
+        const auto palette_index = update.status == CellStatus::EMPTY
+                                       ? std::optional<std::uint8_t>{cell_palette::kEmptyIndex}
+                                       : cell_palette::index_of(update.color);
+        if (!palette_index) {
+            return tl::unexpected<std::string>{"update_cells: color is not in the cell palette"};
+        }
+
+        // 行の差し替え（immerによる構造共有）。ビットボードも同じセルだけ差し替えて同期する
+        row[pos.column] = PackedCell::make(update.status, *palette_index);
+        rows.set(pos.row, row);
+        board.assign(pos.column, pos.row, update.status);
     }
 
-    const Cell& old_cell = this->cells[pos.row][pos.column];
-    if (!is_legal_transition(old_cell.type, status)) {
-        return *this;  // 不正遷移 → 変更なし
-    }
+    return BasicTetrisGrid{this->id,           this->position,    this->size, this->grid_size,
+                           this->cell_factory, rows.persistent(), board};
+}
 
-    if (status == CellStatus::EMPTY) {
-        color = Color::from_string("white");
+template <typename MemoryPolicy>
+BasicRowClearResult<MemoryPolicy> BasicTetrisGrid<MemoryPolicy>::clear_full_rows() const {
+    using grid_bitboard::kFullRow;
+    const int rows = this->grid_size.row;
+
+    // 下の行から見て、揃った行を飛ばしながらビットボードの行を詰める
+    GridBitboard board = this->occupancy;
+    CellRows new_cells = this->cells;
+    int write = rows - 1;
+    for (int read = rows - 1; read >= 0; --read) {
+        if (this->occupancy.filled[read] == kFullRow) {
+            new_cells = new_cells.erase(read);  // 下から消すので上の行のインデックスはずれない
+            continue;
+        }
+        board.filled[write] = this->occupancy.filled[read];
+        board.moving[write] = this->occupancy.moving[read];
+        --write;
     }
 
-    auto updated_cell_result = this->cell_factory.update_cell_state(old_cell, status, color);
-    if (!updated_cell_result.has_value()) {
-        return *this;  // 失敗 → 元のまま
+    const int cleared = write + 1;
+    if (cleared == 0) {
+        return BasicRowClearResult<MemoryPolicy>{0, *this};
     }
 
-    // セル更新（immerによる構造共有）
-    auto new_row = this->cells[pos.row].set(pos.column, updated_cell_result.value());
-    auto new_cells = this->cells.set(pos.row, new_row);
+    // 空いた上端に空行を足す（セルは座標を持たないので値初期化した行でよい）
+    for (int row = 0; row < cleared; ++row) {
+        new_cells = new_cells.push_front(PackedRow{});
+        board.filled[row] = grid_bitboard::wall_row(this->grid_size.column);
+        board.moving[row] = 0;
+    }
+    board.rebuild_surface();
 
-    return TetrisGrid{id, position, size, grid_size, cell_factory, new_cells};
+    return BasicRowClearResult<MemoryPolicy>{
+        cleared, BasicTetrisGrid{this->id, this->position, this->size, this->grid_size,
+                                 this->cell_factory, std::move(new_cells), board}};
 }
+
+// 使うメモリポリシーの分だけ実体化する（TetrisGrid.hpp の extern template と対にする）
+template class BasicTetrisGrid<board_memory::SharedPolicy>;
+template class BasicTetrisGrid<board_memory::LocalPolicy>;
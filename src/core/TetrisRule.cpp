@@ -1,11 +1,50 @@
 #include <core/TetrisRule.hpp>
 
-Tetrimino TetrisRule::drop_tetrimino(const Tetrimino& tetrimino, double delta_time) noexcept {
+TetriminoTypeQueue::TetriminoTypeQueue(std::uint64_t seed) : engine_(seed) {
+    this->initializeNextTetriminos(kMaxPeek);
+}
+
+void TetriminoTypeQueue::initializeNextTetriminos(std::size_t count) {
+    while (this->size_ < count) this->pushBag();
+}
+
+void TetriminoTypeQueue::pushBag() {
+    std::array<TetriminoType, kBagSize> bag{};
+    for (std::size_t i = 0; i < kBagSize; ++i) bag[i] = static_cast<TetriminoType>(i);
+
+    // Fisher–Yates。std::shuffle は実装ごとに結果が異なるので自前で回す
+    for (std::size_t i = kBagSize - 1; i > 0; --i) {
+        const std::size_t j = this->engine_.next_below(static_cast<std::uint32_t>(i + 1));
+        const TetriminoType tmp = bag[i];
+        bag[i] = bag[j];
+        bag[j] = tmp;
+    }
+
+    for (const TetriminoType type : bag) {
+        this->ring_[(this->head_ + this->size_) % kCapacity] = type;
+        ++this->size_;
+    }
+}
+
+TetriminoType TetriminoTypeQueue::getNext() {
+    const TetriminoType next = this->ring_[this->head_];
+    this->head_ = (this->head_ + 1) % kCapacity;
+    --this->size_;
+    this->initializeNextTetriminos(kMaxPeek);
+    return next;
+}
+
+TetriminoType TetriminoTypeQueue::peek(std::size_t index) const noexcept {
+    return this->ring_[(this->head_ + index) % kCapacity];
+}
+
+Tetrimino TetrisRule::drop_tetrimino(const Tetrimino& tetrimino,
+                                     std::uint32_t delta_millis) noexcept {
     if (tetrimino.state == TetriminoStateType::PENDING) {
         return tetrimino;
     }
 
-    this->accumulatedDropTime += delta_time;
+    this->accumulatedDropTime += delta_millis;
     if (this->accumulatedDropTime >= this->dropIntervalMillis) {
         this->accumulatedDropTime -= this->dropIntervalMillis;
         return tetrimino::move(tetrimino, 0, 1);
@@ -0,0 +1,105 @@
+#include <array>
+#include <core/TetrisSimulation.hpp>
+#include <utility>
+
+namespace {
+bool is_down(const Input& input, InputKey key) {
+    return input.is_pressed(key) || input.is_held(key);
+}
+}  // namespace
+
+tl::expected<TetrisSimulation, std::string> TetrisSimulation::create(const GameConfig& config,
+                                                                     std::uint32_t seed) {
+    return LocalTetrisGrid::create("simulation", config).map([seed](LocalTetrisGrid grid) {
+        return TetrisSimulation{std::move(grid), seed};
+    });
+}
+
+TetrisSimulation::TetrisSimulation(LocalTetrisGrid grid, std::uint32_t seed)
+    : grid_(std::move(grid)), current_{}, rule_{}, queue_(seed) {
+    this->spawn_next();
+}
+
+void TetrisSimulation::step(const Input& input) {
+    if (this->game_over_) return;
+    ++this->ticks_;
+
+    const LocalTetrisGrid& grid = *this->grid_;
+    Tetrimino piece = this->current_;
+
+    // ── 入力 ─────────────────────
+    for (const auto& [key, dx] : {std::pair{InputKey::LEFT, -1}, std::pair{InputKey::RIGHT, 1}}) {
+        const Tetrimino moved = tetrimino::move(piece, dx, 0);
+        if (input.is_pressed(key) && grid.can_place(moved)) piece = moved;
+    }
+    if (input.is_pressed(InputKey::ROTATE_RIGHT)) {
+        piece = grid.try_rotate(piece, tetrimino::RotationDirection::CW).value_or(piece);
+    }
+    if (input.is_pressed(InputKey::ROTATE_LEFT)) {
+        piece = grid.try_rotate(piece, tetrimino::RotationDirection::CCW).value_or(piece);
+    }
+    if (input.is_pressed(InputKey::DROP)) {
+        // ハードドロップは着地点で即固定
+        this->current_ = grid.landing_position(piece);
+        this->lock_current();
+        return;
+    }
+    if (is_down(input, InputKey::DOWN) && grid.can_place(tetrimino::drop(piece))) {
+        piece = tetrimino::drop(piece);
+    }
+
+    // ── 自然落下 ─────────────────────
+    const Tetrimino fallen = this->rule_.drop_tetrimino(piece, kTickMillis);
+    if (fallen.pos.y != piece.pos.y && grid.can_place(fallen)) piece = fallen;
+
+    // ── 接地とロック遅延 ─────────────────────
+    if (grid.can_place(tetrimino::drop(piece))) {
+        piece.state = TetriminoStateType::ACTIVE;
+        piece.lock_elapsed_ms = 0;
+    } else {
+        piece.state = TetriminoStateType::PENDING;
+        piece = tetrimino::add_lock_elapsed(piece, kTickMillis);
+        if (piece.lock_elapsed_ms >= tetrimino::kDefaultLockDelayMs) {
+            this->current_ = piece;
+            this->lock_current();
+            return;
+        }
+    }
+    this->current_ = piece;
+}
+
+void TetrisSimulation::lock_current() {
+    const Tetrimino& piece = this->current_;
+    const GridColumnRow origin = tetrimino::origin_of(piece);
+    const auto& cells = tetrimino::shape_data_of(piece.type, piece.rot).cells;
+    const Color color = tetrimino::color_of(piece.type);
+
+    // 固定は EMPTY → MOVING → FILLED の 2 段階なので 8 要求を 1 バッチで流す
+    std::array<CellUpdate, 8> updates{};
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        const GridColumnRow at{origin.column + cells[i].column, origin.row + cells[i].row};
+        updates[i] = CellUpdate{at, CellStatus::MOVING, color};
+        updates[i + cells.size()] = CellUpdate{at, CellStatus::FILLED, color};
+    }
+
+    auto locked = this->grid_->update_cells(updates);
+    if (!locked) {
+        // can_place を満たす位置でしか固定しないので通常は起こらない
+        this->game_over_ = true;
+        return;
+    }
+    ++this->pieces_locked_;
+
+    auto cleared = locked->clear_full_rows();
+    this->lines_cleared_ += cleared.cleared_rows;
+    this->grid_.emplace(std::move(cleared.grid));
+    this->spawn_next();
+}
+
+void TetrisSimulation::spawn_next() {
+    const int column = (this->grid_->grid_size.column - 4) / 2;
+    const Tetrimino spawned =
+        tetrimino::make(Position{static_cast<double>(column), 0}, this->queue_.getNext());
+    this->current_ = spawned;
+    if (!this->grid_->can_place(spawned)) this->game_over_ = true;
+}
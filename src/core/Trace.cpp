@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <core/Trace.hpp>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace {
+// 全スレッドのバッファ。スレッドが終了しても書き出せるよう shared_ptr で持ち続ける
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<trace::ThreadBuffer>> buffers;
+    std::string exit_path;
+    bool exit_registered = false;
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+const trace::Clock::time_point kEpoch = trace::Clock::now();
+std::atomic<bool> g_enabled{true};
+
+trace::ThreadBuffer& local_buffer() {
+    thread_local std::shared_ptr<trace::ThreadBuffer> buffer = [] {
+        auto created = std::make_shared<trace::ThreadBuffer>();
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        created->thread_id = static_cast<std::uint32_t>(reg.buffers.size());
+        reg.buffers.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+void write_escaped(std::ostream& out, const char* text) {
+    for (const char* p = text; *p != '\0'; ++p) {
+        const char c = *p;
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+}
+
+void flush_registered_path() {
+    std::string path;
+    {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        path = reg.exit_path;
+    }
+    if (path.empty()) return;
+    // 終了処理中なので失敗は無視する（書き出せなくても終了は妨げない）
+    static_cast<void>(trace::flush_to_file(path));
+}
+}  // namespace
+
+void trace::set_enabled(bool enabled) noexcept {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool trace::is_enabled() noexcept { return g_enabled.load(std::memory_order_relaxed); }
+
+std::int64_t trace::to_micros(Clock::time_point time) noexcept {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time - kEpoch).count();
+}
+
+void trace::record(const char* category, const char* name, Clock::time_point start,
+                   Clock::time_point end, std::uint32_t depth) noexcept {
+    ThreadBuffer& buffer = local_buffer();
+    const std::uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    const std::int64_t start_us = to_micros(start);
+    buffer.events[index & (kRingCapacity - 1)] =
+        Event{category, name, start_us, std::max<std::int64_t>(to_micros(end) - start_us, 0),
+              depth};
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+std::vector<std::pair<std::uint32_t, trace::Event>> trace::collect() {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        buffers = reg.buffers;
+    }
+
+    std::vector<std::pair<std::uint32_t, Event>> events;
+    for (const auto& buffer : buffers) {
+        const std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+        const std::uint64_t first = written > kRingCapacity ? written - kRingCapacity : 0;
+        // 記録順に並べる（安定ソートで決まらない同順位はこの順のまま残る）
+        for (std::uint64_t i = first; i < written; ++i) {
+            events.emplace_back(buffer->thread_id, buffer->events[i & (kRingCapacity - 1)]);
+        }
+    }
+    // 同時刻に始まったゾーンは長い方、長さも同じ（計測の分解能より短い）なら外側を先に置く。
+    // ゾーンは内側から終わる順に記録されるので、記録順だけでは入れ子の親子が逆になる
+    std::stable_sort(events.begin(), events.end(), [](const auto& lhs, const auto& rhs) {
+        if (lhs.second.start_us != rhs.second.start_us) {
+            return lhs.second.start_us < rhs.second.start_us;
+        }
+        if (lhs.second.duration_us != rhs.second.duration_us) {
+            return lhs.second.duration_us > rhs.second.duration_us;
+        }
+        return lhs.second.depth < rhs.second.depth;
+    });
+    return events;
+}
+
+void trace::write_chrome_json(std::ostream& out) {
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& [thread_id, event] : collect()) {
+        out << (first ? "\n" : ",\n") << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << thread_id
+            << ",\"ts\":" << event.start_us << ",\"dur\":" << event.duration_us << ",\"cat\":\"";
+        write_escaped(out, event.category);
+        out << "\",\"name\":\"";
+        write_escaped(out, event.name);
+        out << "\"}";
+        first = false;
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+tl::expected<void, std::string> trace::flush_to_file(const std::string& path) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) return tl::unexpected("trace: cannot open " + path);
+    write_chrome_json(file);
+    file.flush();
+    if (!file) return tl::unexpected("trace: failed to write " + path);
+    return {};
+}
+
+void trace::clear() noexcept {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const auto& buffer : reg.buffers) buffer->written.store(0, std::memory_order_relaxed);
+}
+
+void trace::flush_at_exit(const std::string& path) {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.exit_path = path;
+    if (!reg.exit_registered) {
+        reg.exit_registered = true;
+        std::atexit(flush_registered_path);
+    }
+}
@@ -0,0 +1,117 @@
+#include <array>
+#include <cmath>
+#include <core/Trace.hpp>
+#include <core/render/BoardRenderCache.hpp>
+
+namespace {
+bool same_row(const TetrisGrid::PackedRow& lhs, const TetrisGrid::PackedRow& rhs, int columns) {
+    for (int column = 0; column < columns; ++column) {
+        if (lhs[column].bits != rhs[column].bits) return false;
+    }
+    return true;
+}
+}  // namespace
+
+TetrisGrid::RowMask BoardRenderCache::changed_rows(const TetrisGrid& grid) const {
+    if (!this->last_grid_) return grid.all_rows();
+    const TetrisGrid& last = *this->last_grid_;
+    // 形や位置が変わったら全行
+    if (last.grid_size.row != grid.grid_size.row ||
+        last.grid_size.column != grid.grid_size.column ||
+        last.cell_factory.size.width != grid.cell_factory.size.width ||
+        last.cell_factory.size.height != grid.cell_factory.size.height) {
+        return grid.all_rows();
+    }
+
+    TetrisGrid::RowMask changed = 0;
+    for (int row = 0; row < grid.grid_size.row; ++row) {
+        const TetrisGrid::PackedRow& now = grid.cells[row];
+        const TetrisGrid::PackedRow& before = last.cells[row];
+        // last_grid_ が生きている間は同じアドレスの要素は同じ値（構造共有された葉）
+        if (&now == &before) continue;
+        if (!same_row(now, before, grid.grid_size.column)) {
+            changed |= TetrisGrid::RowMask{1} << row;
+        }
+    }
+    return changed;
+}
+
+void BoardRenderCache::render_uncached(IRenderer& renderer, const TetrisGrid& grid) {
+    grid.render(renderer);
+    this->last_redrawn_ = grid.all_rows();
+}
+
+void BoardRenderCache::release(IRenderer& renderer) {
+    if (this->target_) renderer.release_texture(*this->target_);
+    this->target_.reset();
+    this->last_grid_.reset();
+    this->valid_ = false;
+    this->unsupported_ = false;
+    this->last_redrawn_ = 0;
+}
+
+void BoardRenderCache::render(IRenderer& renderer, const TetrisGrid& grid) {
+    TRACE_SCOPE("renderer", "BoardRenderCache::render");
+    if (this->unsupported_) {
+        this->render_uncached(renderer, grid);
+        return;
+    }
+
+    // 盤面サイズのテクスチャを用意する（サイズが変わったら作り直す）
+    const int width = static_cast<int>(std::ceil(grid.size.width));
+    const int height = static_cast<int>(std::ceil(grid.size.height));
+    if (!this->target_ || this->target_width_ != width || this->target_height_ != height) {
+        if (this->target_) renderer.release_texture(*this->target_);
+        this->target_.reset();
+        this->valid_ = false;
+        auto created = renderer.create_render_target(width, height);
+        if (!created) {
+            this->unsupported_ = true;
+            this->render_uncached(renderer, grid);
+            return;
+        }
+        this->target_ = *created;
+        this->target_width_ = width;
+        this->target_height_ = height;
+    }
+
+    const TetrisGrid::RowMask dirty = this->valid_ ? this->changed_rows(grid) : grid.all_rows();
+    if (dirty != 0) {
+        if (!renderer.set_render_target(*this->target_)) {
+            this->release(renderer);
+            this->unsupported_ = true;
+            this->render_uncached(renderer, grid);
+            return;
+        }
+
+        // 変わった行を下地で消してから、その行のセルだけを描く（連続する行は 1 枚にまとめる）
+        std::array<ColoredRect, grid_bitboard::kMaxRows> stripes;
+        std::size_t stripe_count = 0;
+        const double cell_height = grid.cell_factory.size.height;
+        for (int row = 0; row < grid.grid_size.row;) {
+            if ((dirty & (TetrisGrid::RowMask{1} << row)) == 0) {
+                ++row;
+                continue;
+            }
+            const int first = row;
+            while (row < grid.grid_size.row && (dirty & (TetrisGrid::RowMask{1} << row)) != 0) {
+                ++row;
+            }
+            stripes[stripe_count++] =
+                ColoredRect{Rect{Position{0.0, first * cell_height},
+                                 Size{static_cast<double>(width), (row - first) * cell_height}},
+                            kBackground};
+        }
+        renderer.fill_rects(stripes.data(), stripe_count);
+        grid.render_rows(renderer, dirty, Position{0.0, 0.0});
+        renderer.set_render_target(std::nullopt);
+    }
+
+    this->last_grid_.emplace(grid);
+    this->valid_ = true;
+    this->last_redrawn_ = dirty;
+
+    const Size texture_size{static_cast<double>(width), static_cast<double>(height)};
+    renderer.draw_texture(*this->target_, Rect{Position{0.0, 0.0}, texture_size},
+                          Rect{grid.position, texture_size});
+}
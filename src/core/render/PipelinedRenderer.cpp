@@ -0,0 +1,207 @@
+#include <core/Trace.hpp>
+#include <core/render/PipelinedRenderer.hpp>
+
+tl::expected<std::unique_ptr<PipelinedRenderer>, std::string> PipelinedRenderer::create(
+    RendererFactory factory, int width, int height) {
+    if (!factory) {
+        return tl::unexpected<std::string>{"PipelinedRenderer: factory must not be empty"};
+    }
+    std::unique_ptr<PipelinedRenderer> pipelined{new PipelinedRenderer{width, height}};
+
+    std::promise<tl::expected<void, std::string>> ready;
+    auto started = ready.get_future();
+    PipelinedRenderer* self = pipelined.get();
+    pipelined->thread_ = std::thread([self, factory = std::move(factory),
+                                      ready = std::move(ready)]() mutable {
+        self->run(std::move(factory), std::move(ready));
+    });
+
+    auto result = started.get();
+    if (!result) {
+        pipelined->thread_.join();  // factory が失敗したらスレッドはすぐ終わっている
+        return tl::unexpected(result.error());
+    }
+    return pipelined;
+}
+
+PipelinedRenderer::~PipelinedRenderer() {
+    if (!this->thread_.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+    }
+    this->wake_.notify_one();
+    this->thread_.join();
+}
+
+void PipelinedRenderer::run(RendererFactory factory,
+                            std::promise<tl::expected<void, std::string>> ready) {
+    auto created = factory();
+    if (!created) {
+        ready.set_value(tl::unexpected(created.error()));
+        return;
+    }
+    // レンダラはこのスレッドで作り、このスレッドで破棄する
+    std::unique_ptr<IRenderer> renderer = std::move(*created);
+    ready.set_value({});
+
+    std::deque<Request> requests;
+    std::deque<Release> releases;  ///< 渡し済みのフレームを描き終えるのを待っている解放
+    std::uint64_t shown = 0;       ///< 最後に描いたフレームの番号
+    for (;;) {
+        bool stop = false;
+        {
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            this->wake_.wait(lock, [this] {
+                return this->stop_ || !this->requests_.empty() || !this->releases_.empty() ||
+                       this->frames_.has_update();
+            });
+            requests.swap(this->requests_);
+            for (Release& release : this->releases_) releases.push_back(std::move(release));
+            this->releases_.clear();
+            stop = this->stop_;
+        }
+        // 依頼はフレームより先に処理する（フレームが使うフォント・テクスチャを先に作る）
+        for (Request& request : requests) request(*renderer);
+        requests.clear();
+
+        if (this->frames_.consume()) {
+            TRACE_SCOPE("renderer", "PipelinedRenderer::present");
+            const Frame& frame = this->frames_.front();
+            renderer->begin_frame();
+            // フレームには描画命令しか入っていないので、再生が失敗することはない
+            static_cast<void>(frame.commands.replay(*renderer));
+            renderer->end_frame();
+            shown = frame.number;
+            this->presented_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // 解放は依頼の前に渡したフレームを描き終えてから。読まれずに捨てられたフレームは
+        // それより新しいフレームを描いた時点で使われないことが確定する
+        while (!releases.empty() && releases.front().after_frame <= shown) {
+            releases.front().request(*renderer);
+            releases.pop_front();
+        }
+        if (stop) break;
+    }
+    // 止める前に渡したフレームは描き終えているので、残りの解放もここで済ませる
+    for (Release& release : releases) release.request(*renderer);
+}
+
+void PipelinedRenderer::post(Request request) {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->requests_.push_back(std::move(request));
+    }
+    this->wake_.notify_one();
+}
+
+void PipelinedRenderer::post_release(Request request) {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        const std::uint64_t published = this->published_.load(std::memory_order_relaxed);
+        this->releases_.push_back(Release{published, std::move(request)});
+    }
+    this->wake_.notify_one();
+}
+
+// ──────────── フレーム制御 ────────────
+void PipelinedRenderer::begin_frame() {
+    // publish で回ってきた枠には、以前のフレームの命令と統計が残っている
+    RecordingRenderer& frame = this->recording();
+    frame.clear_commands();
+    frame.reset_stats();
+}
+
+void PipelinedRenderer::end_frame() {
+    TRACE_SCOPE("renderer", "PipelinedRenderer::publish");
+    this->last_stats_ = this->recording().current_frame();
+    this->frames_.back().number = this->published_.load(std::memory_order_relaxed) + 1;
+    if (this->frames_.publish()) this->dropped_.fetch_add(1, std::memory_order_relaxed);
+    this->published_.fetch_add(1, std::memory_order_relaxed);
+    // 描画スレッドが待ちに入る直前に通知が来ても取りこぼさないよう、ロックを経由して起こす
+    { std::lock_guard<std::mutex> lock(this->mutex_); }
+    this->wake_.notify_one();
+}
+
+bool PipelinedRenderer::set_vsync(bool enabled) {
+    this->post([enabled](IRenderer& renderer) { renderer.set_vsync(enabled); });
+    return false;
+}
+
+void PipelinedRenderer::clear(Color color) { this->recording().clear(color); }
+
+// ──────────── プリミティブ描画 ────────────
+void PipelinedRenderer::fill_rect(const Rect& rect, Color color) {
+    this->recording().fill_rect(rect, color);
+}
+
+void PipelinedRenderer::stroke_rect(const Rect& rect, Color color) {
+    this->recording().stroke_rect(rect, color);
+}
+
+void PipelinedRenderer::fill_rects(const ColoredRect* rects, std::size_t count) {
+    this->recording().fill_rects(rects, count);
+}
+
+void PipelinedRenderer::stroke_rects(const Rect* rects, std::size_t count, Color color) {
+    this->recording().stroke_rects(rects, count, color);
+}
+
+void PipelinedRenderer::draw_line(Position start, Position end, Color color) {
+    this->recording().draw_line(start, end, color);
+}
+
+void PipelinedRenderer::draw_texture(TextureId id, const Rect& src_region, const Rect& dst_region,
+                                     double angle) {
+    this->recording().draw_texture(id, src_region, dst_region, angle);
+}
+
+tl::expected<void, std::string> PipelinedRenderer::draw_text(FontId font_id,
+                                                             const std::string& utf8,
+                                                             Position pos, Color color) {
+    // 描けるかどうかは描画スレッドで分かる。ここでは記録だけして成功を返す
+    return this->recording().draw_text(font_id, utf8, pos, color);
+}
+
+// ──────────── オフスクリーン描画・リソース ────────────
+tl::expected<TextureId, std::string> PipelinedRenderer::create_render_target(int width,
+                                                                             int height) {
+    auto created = this->call<tl::expected<TextureId, std::string>>(
+        [width, height](IRenderer& renderer) {
+            return renderer.create_render_target(width, height);
+        });
+    if (created) this->targets_.insert_or_assign(*created, std::make_pair(width, height));
+    return created;
+}
+
+bool PipelinedRenderer::set_render_target(std::optional<TextureId> target) {
+    RecordingRenderer& frame = this->recording();
+    if (target) {
+        const auto it = this->targets_.find(*target);
+        if (it == this->targets_.end()) return false;
+        // 3 つの枠のどれに記録するかは毎フレーム変わるので、使う枠にその都度教える
+        frame.adopt_render_target(*target, it->second.first, it->second.second);
+    }
+    return frame.set_render_target(target);
+}
+
+void PipelinedRenderer::release_texture(TextureId id) {
+    this->targets_.erase(id);
+    this->post_release([id](IRenderer& renderer) { renderer.release_texture(id); });
+}
+
+tl::expected<TextureId, std::string> PipelinedRenderer::load_texture(const std::string& path) {
+    return this->call<tl::expected<TextureId, std::string>>(
+        [path](IRenderer& renderer) { return renderer.load_texture(path); });
+}
+
+tl::expected<FontId, std::string> PipelinedRenderer::register_font(const std::string& path,
+                                                                   int pt_size) {
+    return this->call<tl::expected<FontId, std::string>>(
+        [path, pt_size](IRenderer& renderer) { return renderer.register_font(path, pt_size); });
+}
+
+void PipelinedRenderer::release_font(FontId id) {
+    this->post_release([id](IRenderer& renderer) { renderer.release_font(id); });
+}
@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <core/render/PixelOps.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TETRIS_PIXEL_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TETRIS_PIXEL_SSE2 1
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define TETRIS_PIXEL_SIMD128 1
+#endif
+
+namespace {
+// SIMD 経路の 16 ビットレーン演算: (s×a + d×inv + 128 + ((…) >> 8)) >> 8
+// 各レーンは最大 255×255 + 128 + 254 = 65407 で 16 ビットに収まる
+
+#if TETRIS_PIXEL_AVX2
+inline __m256i blend16(__m256i d, __m256i premul, __m256i inv, __m256i bias) {
+    __m256i t = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(d, inv), premul), bias);
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+std::size_t blend_simd(std::uint32_t* dst, std::size_t count, Color c) noexcept {
+    const std::uint32_t a = c.a;
+    const auto inv = static_cast<short>(255 - a);
+    const auto pr = static_cast<short>(c.r * a);
+    const auto pg = static_cast<short>(c.g * a);
+    const auto pb = static_cast<short>(c.b * a);
+    const auto pa = static_cast<short>(255 * a);
+    const __m256i premul = _mm256_setr_epi16(pr, pg, pb, pa, pr, pg, pb, pa, pr, pg, pb, pa, pr,
+                                             pg, pb, pa);
+    const __m256i inv16 = _mm256_set1_epi16(inv);
+    const __m256i bias = _mm256_set1_epi16(128);
+    const __m256i zero = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        auto* p = reinterpret_cast<__m256i*>(dst + i);
+        const __m256i d = _mm256_loadu_si256(p);
+        // unpack / pack はどちらも 128 ビットレーン内で働くので、ピクセルの並びは保たれる
+        const __m256i lo = blend16(_mm256_unpacklo_epi8(d, zero), premul, inv16, bias);
+        const __m256i hi = blend16(_mm256_unpackhi_epi8(d, zero), premul, inv16, bias);
+        _mm256_storeu_si256(p, _mm256_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+constexpr const char* kBackend = "avx2";
+#elif TETRIS_PIXEL_SSE2
+inline __m128i blend16(__m128i d, __m128i premul, __m128i inv, __m128i bias) {
+    __m128i t = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(d, inv), premul), bias);
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+std::size_t blend_simd(std::uint32_t* dst, std::size_t count, Color c) noexcept {
+    const std::uint32_t a = c.a;
+    const auto inv = static_cast<short>(255 - a);
+    const auto pr = static_cast<short>(c.r * a);
+    const auto pg = static_cast<short>(c.g * a);
+    const auto pb = static_cast<short>(c.b * a);
+    const auto pa = static_cast<short>(255 * a);
+    const __m128i premul = _mm_setr_epi16(pr, pg, pb, pa, pr, pg, pb, pa);
+    const __m128i inv16 = _mm_set1_epi16(inv);
+    const __m128i bias = _mm_set1_epi16(128);
+    const __m128i zero = _mm_setzero_si128();
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        auto* p = reinterpret_cast<__m128i*>(dst + i);
+        const __m128i d = _mm_loadu_si128(p);
+        const __m128i lo = blend16(_mm_unpacklo_epi8(d, zero), premul, inv16, bias);
+        const __m128i hi = blend16(_mm_unpackhi_epi8(d, zero), premul, inv16, bias);
+        _mm_storeu_si128(p, _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+constexpr const char* kBackend = "sse2";
+#elif TETRIS_PIXEL_SIMD128
+inline v128_t blend16(v128_t d, v128_t premul, v128_t inv, v128_t bias) {
+    v128_t t = wasm_i16x8_add(wasm_i16x8_add(wasm_i16x8_mul(d, inv), premul), bias);
+    return wasm_u16x8_shr(wasm_i16x8_add(t, wasm_u16x8_shr(t, 8)), 8);
+}
+
+std::size_t blend_simd(std::uint32_t* dst, std::size_t count, Color c) noexcept {
+    const std::uint32_t a = c.a;
+    const auto inv = static_cast<std::uint16_t>(255 - a);
+    const auto pr = static_cast<std::uint16_t>(c.r * a);
+    const auto pg = static_cast<std::uint16_t>(c.g * a);
+    const auto pb = static_cast<std::uint16_t>(c.b * a);
+    const auto pa = static_cast<std::uint16_t>(255 * a);
+    const v128_t premul = wasm_u16x8_make(pr, pg, pb, pa, pr, pg, pb, pa);
+    const v128_t inv16 = wasm_u16x8_splat(inv);
+    const v128_t bias = wasm_u16x8_splat(128);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const v128_t d = wasm_v128_load(dst + i);
+        const v128_t lo = blend16(wasm_u16x8_extend_low_u8x16(d), premul, inv16, bias);
+        const v128_t hi = blend16(wasm_u16x8_extend_high_u8x16(d), premul, inv16, bias);
+        wasm_v128_store(dst + i, wasm_u8x16_narrow_i16x8(lo, hi));
+    }
+    return i;
+}
+
+constexpr const char* kBackend = "simd128";
+#else
+std::size_t blend_simd(std::uint32_t*, std::size_t, Color) noexcept { return 0; }
+
+constexpr const char* kBackend = "scalar";
+#endif
+}  // namespace
+
+void pixel_ops::fill_span(std::uint32_t* dst, std::size_t count, Color color) noexcept {
+    std::fill(dst, dst + count, pack(color));
+}
+
+void pixel_ops::blend_span_scalar(std::uint32_t* dst, std::size_t count, Color color) noexcept {
+    for (std::size_t i = 0; i < count; ++i) dst[i] = blend_pixel(dst[i], color);
+}
+
+void pixel_ops::blend_span(std::uint32_t* dst, std::size_t count, Color color) noexcept {
+    if (color.a == 255) {
+        fill_span(dst, count, color);
+        return;
+    }
+    if (color.a == 0) return;
+    const std::size_t done = blend_simd(dst, count, color);
+    blend_span_scalar(dst + done, count - done, color);
+}
+
+const char* pixel_ops::simd_backend() noexcept { return kBackend; }
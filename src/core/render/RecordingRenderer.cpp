@@ -0,0 +1,623 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <core/render/RecordingRenderer.hpp>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace {
+constexpr std::uint64_t kFontKeyOffset = std::uint64_t{1} << 32;
+
+std::uint32_t color_key(Color c) noexcept {
+    return static_cast<std::uint32_t>(c.r) << 24 | static_cast<std::uint32_t>(c.g) << 16 |
+           static_cast<std::uint32_t>(c.b) << 8 | static_cast<std::uint32_t>(c.a);
+}
+
+void write_color(std::ostream& out, Color c) {
+    const std::ios::fmtflags flags = out.flags();
+    const char fill = out.fill();
+    out << '#' << std::hex << std::setfill('0') << std::setw(8) << color_key(c);
+    out.flags(flags);
+    out.fill(fill);
+}
+
+void write_rect(std::ostream& out, const Rect& r) {
+    out << r.pos.x << ',' << r.pos.y << ' ' << r.size.width << 'x' << r.size.height;
+}
+
+void write_id(std::ostream& out, std::optional<std::uint32_t> id) {
+    if (id) {
+        out << *id;
+    } else {
+        out << "screen";
+    }
+}
+
+/// 記録中に払い出した ID を再生先の ID に置き換える（対応がなければそのまま使う）
+std::uint32_t remap(const std::unordered_map<std::uint32_t, std::uint32_t>& ids,
+                    std::uint32_t id) {
+    const auto it = ids.find(id);
+    return it == ids.end() ? id : it->second;
+}
+}  // namespace
+
+const char* to_string(RenderOp op) noexcept {
+    switch (op) {
+        case RenderOp::BEGIN_FRAME:
+            return "begin_frame";
+        case RenderOp::END_FRAME:
+            return "end_frame";
+        case RenderOp::SET_VSYNC:
+            return "set_vsync";
+        case RenderOp::CLEAR:
+            return "clear";
+        case RenderOp::FILL_RECT:
+            return "fill_rect";
+        case RenderOp::STROKE_RECT:
+            return "stroke_rect";
+        case RenderOp::FILL_RECTS:
+            return "fill_rects";
+        case RenderOp::STROKE_RECTS:
+            return "stroke_rects";
+        case RenderOp::DRAW_LINE:
+            return "draw_line";
+        case RenderOp::DRAW_TEXTURE:
+            return "draw_texture";
+        case RenderOp::CREATE_RENDER_TARGET:
+            return "create_render_target";
+        case RenderOp::SET_RENDER_TARGET:
+            return "set_render_target";
+        case RenderOp::RELEASE_TEXTURE:
+            return "release_texture";
+        case RenderOp::LOAD_TEXTURE:
+            return "load_texture";
+        case RenderOp::REGISTER_FONT:
+            return "register_font";
+        case RenderOp::RELEASE_FONT:
+            return "release_font";
+        case RenderOp::DRAW_TEXT:
+            return "draw_text";
+    }
+    return "unknown";
+}
+
+// ──────────── 命令列の読み出し ────────────
+struct RecordingRenderer::Cursor {
+    const std::uint8_t* data;
+    const std::uint8_t* end;
+
+    template <typename T>
+    T get() {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        data += sizeof(T);
+        return value;
+    }
+
+    std::string_view get_string() {
+        const auto size = this->get<std::uint32_t>();
+        const std::string_view text{reinterpret_cast<const char*>(data), size};
+        data += size;
+        return text;
+    }
+
+    /// 要素 size バイトの配列を count 個読み飛ばし、先頭を返す（アラインされていない）
+    const std::uint8_t* skip(std::size_t size, std::uint32_t count) {
+        const std::uint8_t* begin = data;
+        data += size * count;
+        return begin;
+    }
+};
+
+struct RecordingRenderer::Command {
+    RenderOp op{};
+    Color color{};
+    Rect rect{};
+    Rect src{};
+    Position start{};
+    Position end{};
+    double angle = 0.0;
+    std::optional<std::uint32_t> id;  ///< TextureId / FontId（set_render_target の画面は nullopt）
+    int width = 0;
+    int height = 0;
+    bool flag = false;
+    std::uint32_t count = 0;
+    const std::uint8_t* items = nullptr;  ///< fill_rects / stroke_rects の配列
+    std::string_view text;
+};
+
+RecordingRenderer::Command RecordingRenderer::read(Cursor& cursor) {
+    Command cmd;
+    cmd.op = cursor.get<RenderOp>();
+    switch (cmd.op) {
+        case RenderOp::BEGIN_FRAME:
+        case RenderOp::END_FRAME:
+            break;
+        case RenderOp::SET_VSYNC:
+            cmd.flag = cursor.get<bool>();
+            break;
+        case RenderOp::CLEAR:
+            cmd.color = cursor.get<Color>();
+            break;
+        case RenderOp::FILL_RECT:
+        case RenderOp::STROKE_RECT:
+            cmd.rect = cursor.get<Rect>();
+            cmd.color = cursor.get<Color>();
+            break;
+        case RenderOp::FILL_RECTS:
+            cmd.count = cursor.get<std::uint32_t>();
+            cmd.items = cursor.skip(sizeof(ColoredRect), cmd.count);
+            break;
+        case RenderOp::STROKE_RECTS:
+            cmd.color = cursor.get<Color>();
+            cmd.count = cursor.get<std::uint32_t>();
+            cmd.items = cursor.skip(sizeof(Rect), cmd.count);
+            break;
+        case RenderOp::DRAW_LINE:
+            cmd.start = cursor.get<Position>();
+            cmd.end = cursor.get<Position>();
+            cmd.color = cursor.get<Color>();
+            break;
+        case RenderOp::DRAW_TEXTURE:
+            cmd.id = cursor.get<TextureId>();
+            cmd.src = cursor.get<Rect>();
+            cmd.rect = cursor.get<Rect>();
+            cmd.angle = cursor.get<double>();
+            break;
+        case RenderOp::CREATE_RENDER_TARGET:
+            cmd.id = cursor.get<TextureId>();
+            cmd.width = cursor.get<int>();
+            cmd.height = cursor.get<int>();
+            break;
+        case RenderOp::SET_RENDER_TARGET:
+            if (cursor.get<bool>()) cmd.id = cursor.get<TextureId>();
+            break;
+        case RenderOp::RELEASE_TEXTURE:
+        case RenderOp::RELEASE_FONT:
+            cmd.id = cursor.get<std::uint32_t>();
+            break;
+        case RenderOp::LOAD_TEXTURE:
+            cmd.id = cursor.get<TextureId>();
+            cmd.text = cursor.get_string();
+            break;
+        case RenderOp::REGISTER_FONT:
+            cmd.id = cursor.get<FontId>();
+            cmd.height = cursor.get<int>();  // ポイントサイズ
+            cmd.text = cursor.get_string();
+            break;
+        case RenderOp::DRAW_TEXT:
+            cmd.id = cursor.get<FontId>();
+            cmd.start = cursor.get<Position>();
+            cmd.color = cursor.get<Color>();
+            cmd.text = cursor.get_string();
+            break;
+    }
+    return cmd;
+}
+
+// ──────────── 記録 ────────────
+RecordingRenderer::RecordingRenderer(int width, int height) noexcept
+    : width_(width), height_(height) {
+    current_.viewport_pixels = static_cast<std::uint64_t>(std::max(width, 0)) *
+                               static_cast<std::uint64_t>(std::max(height, 0));
+}
+
+void RecordingRenderer::put_op(RenderOp op) {
+    this->put(op);
+    ++this->command_count_;
+}
+
+void RecordingRenderer::put_bytes(const void* data, std::size_t size) {
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    this->arena_.insert(this->arena_.end(), bytes, bytes + size);
+}
+
+void RecordingRenderer::put_string(std::string_view text) {
+    this->put(static_cast<std::uint32_t>(text.size()));
+    this->put_bytes(text.data(), text.size());
+}
+
+void RecordingRenderer::clear_commands() noexcept {
+    this->arena_.clear();
+    this->command_count_ = 0;
+}
+
+void RecordingRenderer::reset_stats() noexcept {
+    const std::uint64_t viewport = this->current_.viewport_pixels;
+    this->current_ = RenderStats{};
+    this->current_.viewport_pixels = viewport;
+    this->frames_.clear();
+    this->last_color_.reset();
+    this->last_texture_.reset();
+}
+
+void RecordingRenderer::count_draw(std::size_t primitives) {
+    ++this->current_.draw_calls;
+    this->current_.primitives += primitives;
+}
+
+void RecordingRenderer::use_color(Color color) {
+    const std::uint32_t key = color_key(color);
+    if (this->last_color_ != key) {
+        ++this->current_.state_changes;
+        this->last_color_ = key;
+    }
+}
+
+void RecordingRenderer::use_texture(std::uint64_t key) {
+    if (this->last_texture_ != key) {
+        ++this->current_.state_changes;
+        this->last_texture_ = key;
+    }
+}
+
+std::pair<int, int> RecordingRenderer::target_size() const {
+    if (this->target_) {
+        if (const auto it = this->target_sizes_.find(*this->target_);
+            it != this->target_sizes_.end()) {
+            return it->second;
+        }
+    }
+    return {this->width_, this->height_};
+}
+
+void RecordingRenderer::cover(const Rect& rect) {
+    const auto [limit_w, limit_h] = this->target_size();
+    // 座標は SDLRenderer と同じく int へ切り捨ててから切り取る
+    const int x = static_cast<int>(rect.pos.x);
+    const int y = static_cast<int>(rect.pos.y);
+    const int x0 = std::max(x, 0);
+    const int y0 = std::max(y, 0);
+    const int x1 = std::min(x + static_cast<int>(rect.size.width), limit_w);
+    const int y1 = std::min(y + static_cast<int>(rect.size.height), limit_h);
+    if (x0 >= x1 || y0 >= y1) return;
+    this->current_.pixels_covered +=
+        static_cast<std::uint64_t>(x1 - x0) * static_cast<std::uint64_t>(y1 - y0);
+}
+
+void RecordingRenderer::begin_frame() {
+    this->put_op(RenderOp::BEGIN_FRAME);
+    const std::uint64_t viewport = this->current_.viewport_pixels;
+    this->current_ = RenderStats{};
+    this->current_.viewport_pixels = viewport;
+}
+
+void RecordingRenderer::end_frame() {
+    this->put_op(RenderOp::END_FRAME);
+    this->frames_.push_back(this->current_);
+}
+
+bool RecordingRenderer::set_vsync(bool enabled) {
+    this->put_op(RenderOp::SET_VSYNC);
+    this->put(enabled);
+    return true;
+}
+
+void RecordingRenderer::clear(Color color) {
+    this->put_op(RenderOp::CLEAR);
+    this->put(color);
+    const auto [width, height] = this->target_size();
+    this->cover(Rect{{0, 0}, {static_cast<double>(width), static_cast<double>(height)}});
+}
+
+void RecordingRenderer::fill_rect(const Rect& rect, Color color) {
+    this->put_op(RenderOp::FILL_RECT);
+    this->put(rect);
+    this->put(color);
+    this->count_draw(1);
+    this->use_color(color);
+    this->cover(rect);
+}
+
+void RecordingRenderer::cover_outline(const Rect& rect) {
+    // 上下の辺と、角を除いた左右の辺
+    const double w = rect.size.width;
+    const double h = rect.size.height;
+    this->cover(Rect{rect.pos, {w, std::min(h, 1.0)}});
+    if (h <= 1) return;
+    this->cover(Rect{{rect.pos.x, rect.pos.y + h - 1}, {w, 1}});
+    this->cover(Rect{{rect.pos.x, rect.pos.y + 1}, {std::min(w, 1.0), h - 2}});
+    if (w > 1) this->cover(Rect{{rect.pos.x + w - 1, rect.pos.y + 1}, {1, h - 2}});
+}
+
+void RecordingRenderer::stroke_rect(const Rect& rect, Color color) {
+    this->put_op(RenderOp::STROKE_RECT);
+    this->put(rect);
+    this->put(color);
+    this->count_draw(1);
+    this->use_color(color);
+    this->cover_outline(rect);
+}
+
+void RecordingRenderer::fill_rects(const ColoredRect* rects, std::size_t count) {
+    this->put_op(RenderOp::FILL_RECTS);
+    this->put(static_cast<std::uint32_t>(count));
+    this->put_bytes(rects, sizeof(ColoredRect) * count);
+    if (count == 0) return;
+    this->count_draw(count);
+    for (std::size_t i = 0; i < count; ++i) this->cover(rects[i].rect);
+}
+
+void RecordingRenderer::stroke_rects(const Rect* rects, std::size_t count, Color color) {
+    this->put_op(RenderOp::STROKE_RECTS);
+    this->put(color);
+    this->put(static_cast<std::uint32_t>(count));
+    this->put_bytes(rects, sizeof(Rect) * count);
+    if (count == 0) return;
+    this->count_draw(count);
+    this->use_color(color);
+    for (std::size_t i = 0; i < count; ++i) this->cover_outline(rects[i]);
+}
+
+void RecordingRenderer::draw_line(Position start, Position end, Color color) {
+    this->put_op(RenderOp::DRAW_LINE);
+    this->put(start);
+    this->put(end);
+    this->put(color);
+    this->count_draw(1);
+    this->use_color(color);
+    const int dx = std::abs(static_cast<int>(end.x) - static_cast<int>(start.x));
+    const int dy = std::abs(static_cast<int>(end.y) - static_cast<int>(start.y));
+    this->current_.pixels_covered += static_cast<std::uint64_t>(std::max(dx, dy) + 1);
+}
+
+void RecordingRenderer::draw_texture(TextureId id, const Rect& src_region, const Rect& dst_region,
+                                     double angle) {
+    this->put_op(RenderOp::DRAW_TEXTURE);
+    this->put(id);
+    this->put(src_region);
+    this->put(dst_region);
+    this->put(angle);
+    this->count_draw(1);
+    this->use_texture(id);
+    this->cover(dst_region);
+}
+
+tl::expected<TextureId, std::string> RecordingRenderer::create_render_target(int width,
+                                                                             int height) {
+    if (width <= 0 || height <= 0) {
+        return tl::unexpected<std::string>{"RecordingRenderer: invalid render target size"};
+    }
+    const TextureId id = this->next_texture_id_++;
+    this->put_op(RenderOp::CREATE_RENDER_TARGET);
+    this->put(id);
+    this->put(width);
+    this->put(height);
+    this->target_sizes_.emplace(id, std::make_pair(width, height));
+    return id;
+}
+
+bool RecordingRenderer::set_render_target(std::optional<TextureId> target) {
+    if (target && this->target_sizes_.find(*target) == this->target_sizes_.end()) return false;
+    this->put_op(RenderOp::SET_RENDER_TARGET);
+    this->put(target.has_value());
+    if (target) this->put(*target);
+    if (this->target_ != target) {
+        ++this->current_.state_changes;
+        this->target_ = target;
+    }
+    return true;
+}
+
+void RecordingRenderer::adopt_render_target(TextureId id, int width, int height) {
+    this->target_sizes_.insert_or_assign(id, std::make_pair(width, height));
+}
+
+void RecordingRenderer::release_texture(TextureId id) {
+    this->put_op(RenderOp::RELEASE_TEXTURE);
+    this->put(id);
+    if (this->target_ == id) this->target_.reset();
+    this->target_sizes_.erase(id);
+}
+
+tl::expected<TextureId, std::string> RecordingRenderer::load_texture(const std::string& path) {
+    const TextureId id = this->next_texture_id_++;
+    this->put_op(RenderOp::LOAD_TEXTURE);
+    this->put(id);
+    this->put_string(path);
+    return id;
+}
+
+tl::expected<FontId, std::string> RecordingRenderer::register_font(const std::string& path,
+                                                                   int pt_size) {
+    const FontId id = this->next_font_id_++;
+    this->put_op(RenderOp::REGISTER_FONT);
+    this->put(id);
+    this->put(pt_size);
+    this->put_string(path);
+    return id;
+}
+
+void RecordingRenderer::release_font(FontId id) {
+    this->put_op(RenderOp::RELEASE_FONT);
+    this->put(id);
+}
+
+tl::expected<void, std::string> RecordingRenderer::draw_text(FontId font_id,
+                                                             const std::string& utf8,
+                                                             Position pos, Color color) {
+    this->put_op(RenderOp::DRAW_TEXT);
+    this->put(font_id);
+    this->put(pos);
+    this->put(color);
+    this->put_string(utf8);
+    this->count_draw(1);
+    this->use_texture(kFontKeyOffset + font_id);  // グリフアトラスのテクスチャ
+    return {};
+}
+
+// ──────────── 再生・書き出し ────────────
+tl::expected<void, std::string> RecordingRenderer::replay(IRenderer& target) const {
+    std::unordered_map<std::uint32_t, std::uint32_t> textures;
+    std::unordered_map<std::uint32_t, std::uint32_t> fonts;
+    std::vector<ColoredRect> fills;
+    std::vector<Rect> strokes;
+
+    Cursor cursor{this->arena_.data(), this->arena_.data() + this->arena_.size()};
+    while (cursor.data < cursor.end) {
+        const Command cmd = read(cursor);
+        switch (cmd.op) {
+            case RenderOp::BEGIN_FRAME:
+                target.begin_frame();
+                break;
+            case RenderOp::END_FRAME:
+                target.end_frame();
+                break;
+            case RenderOp::SET_VSYNC:
+                target.set_vsync(cmd.flag);
+                break;
+            case RenderOp::CLEAR:
+                target.clear(cmd.color);
+                break;
+            case RenderOp::FILL_RECT:
+                target.fill_rect(cmd.rect, cmd.color);
+                break;
+            case RenderOp::STROKE_RECT:
+                target.stroke_rect(cmd.rect, cmd.color);
+                break;
+            case RenderOp::FILL_RECTS:
+                // アリーナ上の配列はアラインされていないので詰め直して渡す
+                fills.resize(cmd.count);
+                std::memcpy(fills.data(), cmd.items, sizeof(ColoredRect) * cmd.count);
+                target.fill_rects(fills.data(), fills.size());
+                break;
+            case RenderOp::STROKE_RECTS:
+                strokes.resize(cmd.count);
+                std::memcpy(strokes.data(), cmd.items, sizeof(Rect) * cmd.count);
+                target.stroke_rects(strokes.data(), strokes.size(), cmd.color);
+                break;
+            case RenderOp::DRAW_LINE:
+                target.draw_line(cmd.start, cmd.end, cmd.color);
+                break;
+            case RenderOp::DRAW_TEXTURE:
+                target.draw_texture(remap(textures, *cmd.id), cmd.src, cmd.rect, cmd.angle);
+                break;
+            case RenderOp::CREATE_RENDER_TARGET: {
+                auto created = target.create_render_target(cmd.width, cmd.height);
+                if (!created) return tl::unexpected(created.error());
+                textures[*cmd.id] = *created;
+                break;
+            }
+            case RenderOp::SET_RENDER_TARGET:
+                target.set_render_target(cmd.id ? std::optional<TextureId>{remap(textures, *cmd.id)}
+                                                : std::nullopt);
+                break;
+            case RenderOp::RELEASE_TEXTURE:
+                target.release_texture(remap(textures, *cmd.id));
+                textures.erase(*cmd.id);
+                break;
+            case RenderOp::LOAD_TEXTURE: {
+                auto loaded = target.load_texture(std::string{cmd.text});
+                if (!loaded) return tl::unexpected(loaded.error());
+                textures[*cmd.id] = *loaded;
+                break;
+            }
+            case RenderOp::REGISTER_FONT: {
+                auto font = target.register_font(std::string{cmd.text}, cmd.height);
+                if (!font) return tl::unexpected(font.error());
+                fonts[*cmd.id] = *font;
+                break;
+            }
+            case RenderOp::RELEASE_FONT:
+                target.release_font(remap(fonts, *cmd.id));
+                fonts.erase(*cmd.id);
+                break;
+            case RenderOp::DRAW_TEXT: {
+                // 描けなかった文字列は再生を止めない（描画時と同じく呼び出し側の責任）
+                const auto drawn = target.draw_text(remap(fonts, *cmd.id), std::string{cmd.text},
+                                                    cmd.start, cmd.color);
+                (void)drawn;
+                break;
+            }
+        }
+    }
+    return {};
+}
+
+void RecordingRenderer::dump(std::ostream& out) const {
+    Cursor cursor{this->arena_.data(), this->arena_.data() + this->arena_.size()};
+    while (cursor.data < cursor.end) {
+        const Command cmd = read(cursor);
+        out << to_string(cmd.op);
+        switch (cmd.op) {
+            case RenderOp::BEGIN_FRAME:
+            case RenderOp::END_FRAME:
+                break;
+            case RenderOp::SET_VSYNC:
+                out << (cmd.flag ? " on" : " off");
+                break;
+            case RenderOp::CLEAR:
+                out << ' ';
+                write_color(out, cmd.color);
+                break;
+            case RenderOp::FILL_RECT:
+            case RenderOp::STROKE_RECT:
+                out << ' ';
+                write_rect(out, cmd.rect);
+                out << ' ';
+                write_color(out, cmd.color);
+                break;
+            case RenderOp::FILL_RECTS:
+                out << ' ' << cmd.count;
+                for (std::uint32_t i = 0; i < cmd.count; ++i) {
+                    ColoredRect item;
+                    std::memcpy(&item, cmd.items + i * sizeof(ColoredRect), sizeof(ColoredRect));
+                    out << "\n  ";
+                    write_rect(out, item.rect);
+                    out << ' ';
+                    write_color(out, item.color);
+                }
+                break;
+            case RenderOp::STROKE_RECTS:
+                out << ' ' << cmd.count << ' ';
+                write_color(out, cmd.color);
+                for (std::uint32_t i = 0; i < cmd.count; ++i) {
+                    Rect item;
+                    std::memcpy(&item, cmd.items + i * sizeof(Rect), sizeof(Rect));
+                    out << "\n  ";
+                    write_rect(out, item);
+                }
+                break;
+            case RenderOp::DRAW_LINE:
+                out << ' ' << cmd.start.x << ',' << cmd.start.y << " -> " << cmd.end.x << ','
+                    << cmd.end.y << ' ';
+                write_color(out, cmd.color);
+                break;
+            case RenderOp::DRAW_TEXTURE:
+                out << ' ' << *cmd.id << " src ";
+                write_rect(out, cmd.src);
+                out << " dst ";
+                write_rect(out, cmd.rect);
+                if (cmd.angle != 0.0) out << " angle " << cmd.angle;
+                break;
+            case RenderOp::CREATE_RENDER_TARGET:
+                out << ' ' << *cmd.id << ' ' << cmd.width << 'x' << cmd.height;
+                break;
+            case RenderOp::SET_RENDER_TARGET:
+            case RenderOp::RELEASE_TEXTURE:
+            case RenderOp::RELEASE_FONT:
+                out << ' ';
+                write_id(out, cmd.id);
+                break;
+            case RenderOp::LOAD_TEXTURE:
+                out << ' ' << *cmd.id << " \"" << cmd.text << '"';
+                break;
+            case RenderOp::REGISTER_FONT:
+                out << ' ' << *cmd.id << " \"" << cmd.text << "\" " << cmd.height;
+                break;
+            case RenderOp::DRAW_TEXT:
+                out << ' ' << *cmd.id << ' ' << cmd.start.x << ',' << cmd.start.y << ' ';
+                write_color(out, cmd.color);
+                out << " \"" << cmd.text << '"';
+                break;
+        }
+        out << '\n';
+    }
+}
+
+std::string RecordingRenderer::dump() const {
+    std::ostringstream out;
+    this->dump(out);
+    return out.str();
+}
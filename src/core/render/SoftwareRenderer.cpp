@@ -0,0 +1,380 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <core/Trace.hpp>
+#include <core/render/PixelOps.hpp>
+#include <core/render/SoftwareRenderer.hpp>
+#include <cstdlib>
+#include <fstream>
+
+namespace {
+// 1 辺の上限（幅 × 高さ × 4 が 32 ビットの PNG チャンクに収まる大きさ）
+constexpr int kMaxDimension = 16384;
+
+struct IntRect {
+    int x, y, w, h;
+};
+
+IntRect to_int_rect(const Rect& r) {
+    return IntRect{static_cast<int>(r.pos.x), static_cast<int>(r.pos.y),
+                   static_cast<int>(r.size.width), static_cast<int>(r.size.height)};
+}
+
+Framebuffer make_framebuffer(int width, int height, std::uint32_t fill) {
+    Framebuffer fb;
+    fb.width = width;
+    fb.height = height;
+    fb.pixels.assign(static_cast<std::size_t>(width) * static_cast<std::size_t>(height), fill);
+    return fb;
+}
+
+bool valid_size(int width, int height) {
+    return width > 0 && height > 0 && width <= kMaxDimension && height <= kMaxDimension;
+}
+
+/**
+ * 線分を矩形 [0, max_x] × [0, max_y] に切り詰める（Cohen–Sutherland）
+ *   - 整数に変換する前に呼ぶ。範囲外の巨大な座標をそのまま int にするのは未定義動作
+ * @return 線分が矩形にかからない（または座標が有限でない）なら false
+ */
+bool clip_line(Position& a, Position& b, double max_x, double max_y) {
+    if (!std::isfinite(a.x) || !std::isfinite(a.y) || !std::isfinite(b.x) ||
+        !std::isfinite(b.y)) {
+        return false;
+    }
+    enum : unsigned { kLeft = 1, kRight = 2, kTop = 4, kBottom = 8 };
+    const auto outcode = [&](const Position& p) {
+        unsigned code = 0;
+        if (p.x < 0.0) code |= kLeft;
+        if (p.x > max_x) code |= kRight;
+        if (p.y < 0.0) code |= kTop;
+        if (p.y > max_y) code |= kBottom;
+        return code;
+    };
+
+    unsigned code_a = outcode(a);
+    unsigned code_b = outcode(b);
+    for (;;) {
+        if ((code_a | code_b) == 0) return true;
+        if ((code_a & code_b) != 0) return false;
+
+        // 外側にある方の端点を、はみ出している辺との交点まで動かす
+        const unsigned out = code_a != 0 ? code_a : code_b;
+        Position p{};
+        if (out & kBottom) {
+            p = Position{a.x + (b.x - a.x) * (max_y - a.y) / (b.y - a.y), max_y};
+        } else if (out & kTop) {
+            p = Position{a.x + (b.x - a.x) * (0.0 - a.y) / (b.y - a.y), 0.0};
+        } else if (out & kRight) {
+            p = Position{max_x, a.y + (b.y - a.y) * (max_x - a.x) / (b.x - a.x)};
+        } else {
+            p = Position{0.0, a.y + (b.y - a.y) * (0.0 - a.x) / (b.x - a.x)};
+        }
+        if (out == code_a) {
+            a = p;
+            code_a = outcode(a);
+        } else {
+            b = p;
+            code_b = outcode(b);
+        }
+    }
+}
+
+// ──────────── PNG ────────────
+const std::array<std::uint32_t, 256>& crc_table() {
+    static const std::array<std::uint32_t, 256> table = [] {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t n = 0; n < 256; ++n) {
+            std::uint32_t c = n;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[n] = c;
+        }
+        return t;
+    }();
+    return table;
+}
+
+void put_u32(std::vector<std::uint8_t>& out, std::uint32_t v) {
+    out.push_back(static_cast<std::uint8_t>(v >> 24));
+    out.push_back(static_cast<std::uint8_t>(v >> 16));
+    out.push_back(static_cast<std::uint8_t>(v >> 8));
+    out.push_back(static_cast<std::uint8_t>(v));
+}
+
+/// 長さ・種類・データ・CRC（種類とデータが対象）を書く
+void put_chunk(std::vector<std::uint8_t>& out, const char (&type)[5],
+               const std::vector<std::uint8_t>& data) {
+    put_u32(out, static_cast<std::uint32_t>(data.size()));
+    const std::size_t crc_begin = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    std::uint32_t crc = 0xFFFFFFFFu;
+    const auto& table = crc_table();
+    for (std::size_t i = crc_begin; i < out.size(); ++i) {
+        crc = table[(crc ^ out[i]) & 0xFF] ^ (crc >> 8);
+    }
+    put_u32(out, crc ^ 0xFFFFFFFFu);
+}
+
+/// 各行の先頭にフィルタ種別 0 を付けた RGBA8 の列
+std::vector<std::uint8_t> scanlines(const Framebuffer& fb) {
+    std::vector<std::uint8_t> raw;
+    raw.reserve(static_cast<std::size_t>(fb.height) * (1 + static_cast<std::size_t>(fb.width) * 4));
+    for (int y = 0; y < fb.height; ++y) {
+        raw.push_back(0);
+        const std::uint32_t* row = fb.row(y);
+        for (int x = 0; x < fb.width; ++x) {
+            const Color c = pixel_ops::unpack(row[x]);
+            raw.insert(raw.end(), {c.r, c.g, c.b, c.a});
+        }
+    }
+    return raw;
+}
+
+/// zlib ストリーム（無圧縮ブロックの並び + Adler-32）
+std::vector<std::uint8_t> zlib_stored(const std::vector<std::uint8_t>& raw) {
+    constexpr std::size_t kMaxBlock = 65535;
+    std::vector<std::uint8_t> out;
+    out.reserve(raw.size() + raw.size() / kMaxBlock * 5 + 16);
+    out.push_back(0x78);  // CMF: deflate, 32 KiB 窓
+    out.push_back(0x01);  // FLG: (CMF × 256 + FLG) % 31 == 0
+    std::size_t offset = 0;
+    do {
+        const std::size_t len = std::min(kMaxBlock, raw.size() - offset);
+        const bool last = offset + len == raw.size();
+        out.push_back(last ? 1 : 0);
+        out.push_back(static_cast<std::uint8_t>(len));
+        out.push_back(static_cast<std::uint8_t>(len >> 8));
+        out.push_back(static_cast<std::uint8_t>(~len));
+        out.push_back(static_cast<std::uint8_t>(~len >> 8));
+        out.insert(out.end(), raw.begin() + static_cast<std::ptrdiff_t>(offset),
+                   raw.begin() + static_cast<std::ptrdiff_t>(offset + len));
+        offset += len;
+    } while (offset < raw.size());
+
+    std::uint32_t a = 1;
+    std::uint32_t b = 0;
+    for (const std::uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    put_u32(out, (b << 16) | a);
+    return out;
+}
+
+tl::expected<void, std::string> write_file(const std::string& path,
+                                           const std::vector<std::uint8_t>& bytes) {
+    std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file) return tl::unexpected("SoftwareRenderer: cannot open " + path);
+    file.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+    file.flush();
+    if (!file) return tl::unexpected("SoftwareRenderer: failed to write " + path);
+    return {};
+}
+}  // namespace
+
+std::vector<std::uint8_t> encode_png(const Framebuffer& framebuffer) {
+    TRACE_SCOPE("renderer", "encode_png");
+    std::vector<std::uint8_t> png{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    std::vector<std::uint8_t> header;
+    put_u32(header, static_cast<std::uint32_t>(framebuffer.width));
+    put_u32(header, static_cast<std::uint32_t>(framebuffer.height));
+    header.insert(header.end(), {8, 6, 0, 0, 0});  // 8 ビット RGBA, deflate, フィルタ 0, 非インターレース
+    put_chunk(png, "IHDR", header);
+    put_chunk(png, "IDAT", zlib_stored(scanlines(framebuffer)));
+    put_chunk(png, "IEND", {});
+    return png;
+}
+
+// ──────────── create (ファクトリ) ────────────
+tl::expected<std::unique_ptr<SoftwareRenderer>, std::string> SoftwareRenderer::create(int width,
+                                                                                      int height) {
+    if (!valid_size(width, height)) {
+        return tl::unexpected("SoftwareRenderer: invalid size " + std::to_string(width) + "x" +
+                              std::to_string(height));
+    }
+    return std::unique_ptr<SoftwareRenderer>{new SoftwareRenderer{
+        make_framebuffer(width, height, pixel_ops::pack(colors::kBlack))}};
+}
+
+Framebuffer& SoftwareRenderer::target() noexcept {
+    if (this->target_) {
+        if (auto it = this->textures_.find(*this->target_); it != this->textures_.end()) {
+            return it->second;
+        }
+    }
+    return this->screen_;
+}
+
+void SoftwareRenderer::blend_rect(int x0, int y0, int x1, int y1, Color color) {
+    Framebuffer& fb = this->target();
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, fb.width);
+    y1 = std::min(y1, fb.height);
+    if (x0 >= x1 || y0 >= y1) return;
+    const auto span = static_cast<std::size_t>(x1 - x0);
+    for (int y = y0; y < y1; ++y) pixel_ops::blend_span(fb.row(y) + x0, span, color);
+}
+
+// ──────────── 描画 ────────────
+void SoftwareRenderer::clear(Color color) {
+    TRACE_SCOPE("renderer", "SoftwareRenderer::clear");
+    Framebuffer& fb = this->target();
+    pixel_ops::fill_span(fb.pixels.data(), fb.pixels.size(), color);
+}
+
+void SoftwareRenderer::fill_rect(const Rect& rect, Color color) {
+    TRACE_SCOPE("renderer", "SoftwareRenderer::fill_rect");
+    const IntRect r = to_int_rect(rect);
+    if (r.w <= 0 || r.h <= 0) return;
+    this->blend_rect(r.x, r.y, r.x + r.w, r.y + r.h, color);
+}
+
+void SoftwareRenderer::stroke_rect(const Rect& rect, Color color) {
+    TRACE_SCOPE("renderer", "SoftwareRenderer::stroke_rect");
+    const IntRect r = to_int_rect(rect);
+    if (r.w <= 0 || r.h <= 0) return;
+    const int right = r.x + r.w;
+    const int bottom = r.y + r.h;
+    this->blend_rect(r.x, r.y, right, r.y + 1, color);  // 上辺
+    if (r.h == 1) return;
+    this->blend_rect(r.x, bottom - 1, right, bottom, color);  // 下辺
+    // 左右の辺は上下の辺と重ならない部分だけ
+    this->blend_rect(r.x, r.y + 1, r.x + 1, bottom - 1, color);
+    if (r.w > 1) this->blend_rect(right - 1, r.y + 1, right, bottom - 1, color);
+}
+
+void SoftwareRenderer::draw_line(Position start, Position end, Color color) {
+    TRACE_SCOPE("renderer", "SoftwareRenderer::draw_line");
+    Framebuffer& fb = this->target();
+    if (!clip_line(start, end, fb.width - 1, fb.height - 1)) return;
+
+    int x0 = static_cast<int>(start.x);
+    int y0 = static_cast<int>(start.y);
+    const int x1 = static_cast<int>(end.x);
+    const int y1 = static_cast<int>(end.y);
+
+    // 水平線はスパン 1 本で済ませる
+    if (y0 == y1) {
+        this->blend_rect(std::min(x0, x1), y0, std::max(x0, x1) + 1, y0 + 1, color);
+        return;
+    }
+
+    const int dx = std::abs(x1 - x0);
+    const int dy = -std::abs(y1 - y0);
+    const int sx = x0 < x1 ? 1 : -1;
+    const int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    for (;;) {
+        if (x0 >= 0 && y0 >= 0 && x0 < fb.width && y0 < fb.height) {
+            std::uint32_t& pixel = fb.row(y0)[x0];
+            pixel = pixel_ops::blend_pixel(pixel, color);
+        }
+        if (x0 == x1 && y0 == y1) break;
+        const int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void SoftwareRenderer::draw_texture(TextureId id, const Rect& src_region, const Rect& dst_region,
+                                    double angle) {
+    TRACE_SCOPE("renderer", "SoftwareRenderer::draw_texture");
+    (void)angle;
+    const auto it = this->textures_.find(id);
+    if (it == this->textures_.end()) return;
+    const Framebuffer& tex = it->second;
+    Framebuffer& fb = this->target();
+    if (&tex == &fb) return;  // 自分自身への描画は未定義なので何もしない
+
+    const IntRect src = to_int_rect(src_region);
+    const IntRect dst = to_int_rect(dst_region);
+    if (src.w <= 0 || src.h <= 0 || dst.w <= 0 || dst.h <= 0) return;
+
+    const int x0 = std::max(dst.x, 0);
+    const int y0 = std::max(dst.y, 0);
+    const int x1 = std::min(dst.x + dst.w, fb.width);
+    const int y1 = std::min(dst.y + dst.h, fb.height);
+    for (int y = y0; y < y1; ++y) {
+        const int sy = src.y + static_cast<int>(static_cast<long long>(y - dst.y) * src.h / dst.h);
+        if (sy < 0 || sy >= tex.height) continue;
+        const std::uint32_t* src_row = tex.row(sy);
+        std::uint32_t* dst_row = fb.row(y);
+        for (int x = x0; x < x1; ++x) {
+            const int sx =
+                src.x + static_cast<int>(static_cast<long long>(x - dst.x) * src.w / dst.w);
+            if (sx < 0 || sx >= tex.width) continue;
+            const std::uint32_t texel = src_row[sx];
+            if ((texel >> 24) == 0xFF) {
+                dst_row[x] = texel;
+            } else {
+                dst_row[x] = pixel_ops::blend_pixel(dst_row[x], pixel_ops::unpack(texel));
+            }
+        }
+    }
+}
+
+// ──────────── オフスクリーン描画 ────────────
+tl::expected<TextureId, std::string> SoftwareRenderer::create_render_target(int width,
+                                                                            int height) {
+    if (!valid_size(width, height)) {
+        return tl::unexpected("SoftwareRenderer: invalid render target size " +
+                              std::to_string(width) + "x" + std::to_string(height));
+    }
+    const TextureId id = this->next_id_++;
+    this->textures_.emplace(id, make_framebuffer(width, height, 0));
+    return id;
+}
+
+bool SoftwareRenderer::set_render_target(std::optional<TextureId> target) {
+    if (target && this->textures_.find(*target) == this->textures_.end()) return false;
+    this->target_ = target;
+    return true;
+}
+
+void SoftwareRenderer::release_texture(TextureId id) {
+    if (this->target_ == id) this->target_.reset();
+    this->textures_.erase(id);
+}
+
+// ──────────── フォント関連 ────────────
+tl::expected<FontId, std::string> SoftwareRenderer::register_font(const std::string& path,
+                                                                  int pt_size) {
+    (void)pt_size;
+    return tl::unexpected("SoftwareRenderer: fonts are not supported: " + path);
+}
+
+tl::expected<void, std::string> SoftwareRenderer::draw_text(FontId font_id,
+                                                            const std::string& utf8, Position pos,
+                                                            Color color) {
+    (void)font_id;
+    (void)utf8;
+    (void)pos;
+    (void)color;
+    return tl::unexpected<std::string>{"SoftwareRenderer: draw_text is not supported"};
+}
+
+// ──────────── 書き出し ────────────
+tl::expected<void, std::string> SoftwareRenderer::write_png(const std::string& path) const {
+    return write_file(path, encode_png(this->screen_));
+}
+
+tl::expected<void, std::string> SoftwareRenderer::write_raw(const std::string& path) const {
+    TRACE_SCOPE("renderer", "SoftwareRenderer::write_raw");
+    std::vector<std::uint8_t> bytes;
+    bytes.reserve(this->screen_.pixels.size() * 4);
+    for (const std::uint32_t pixel : this->screen_.pixels) {
+        const Color c = pixel_ops::unpack(pixel);
+        bytes.insert(bytes.end(), {c.r, c.g, c.b, c.a});
+    }
+    return write_file(path, bytes);
+}
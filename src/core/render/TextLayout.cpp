@@ -0,0 +1,140 @@
+#include <core/render/TextLayout.hpp>
+#include <functional>
+#include <iterator>
+
+void decode_utf8(std::string_view utf8, std::vector<char32_t>& out) {
+    constexpr char32_t kReplacement = 0xFFFD;
+    std::size_t i = 0;
+    while (i < utf8.size()) {
+        const auto lead = static_cast<unsigned char>(utf8[i]);
+        int length = 0;
+        char32_t code = 0;
+        char32_t min_code = 0;
+        if (lead < 0x80) {
+            out.push_back(lead);
+            ++i;
+            continue;
+        }
+        if ((lead & 0xE0) == 0xC0) {
+            length = 2;
+            code = lead & 0x1F;
+            min_code = 0x80;
+        } else if ((lead & 0xF0) == 0xE0) {
+            length = 3;
+            code = lead & 0x0F;
+            min_code = 0x800;
+        } else if ((lead & 0xF8) == 0xF0) {
+            length = 4;
+            code = lead & 0x07;
+            min_code = 0x10000;
+        } else {
+            out.push_back(kReplacement);
+            ++i;
+            continue;
+        }
+
+        int consumed = 1;
+        for (; consumed < length && i + consumed < utf8.size(); ++consumed) {
+            const auto next = static_cast<unsigned char>(utf8[i + consumed]);
+            if ((next & 0xC0) != 0x80) break;
+            code = (code << 6) | (next & 0x3F);
+        }
+        // 途中で切れた列・冗長な表現・サロゲート・範囲外は 1 文字の置換文字にする
+        if (consumed != length || code < min_code || code > 0x10FFFF ||
+            (code >= 0xD800 && code <= 0xDFFF)) {
+            code = kReplacement;
+        }
+        out.push_back(code);
+        i += static_cast<std::size_t>(consumed);
+    }
+}
+
+std::optional<ShelfPacker::Placement> ShelfPacker::insert(int w, int h) {
+    if (w <= 0 || h <= 0) return Placement{0, 0};
+    const int padded_w = w + this->padding_;
+    const int padded_h = h + this->padding_;
+
+    // 入る棚のうち、無駄な高さが最も少ないもの
+    Shelf* best = nullptr;
+    for (Shelf& shelf : this->shelves_) {
+        if (shelf.height < padded_h || shelf.height > padded_h + padded_h / 4) continue;
+        if (shelf.cursor_x + padded_w > this->width_) continue;
+        if (!best || shelf.height < best->height) best = &shelf;
+    }
+    if (!best) {
+        if (padded_w > this->width_ || this->next_shelf_y_ + padded_h > this->height_) {
+            return std::nullopt;
+        }
+        this->shelves_.push_back(Shelf{this->next_shelf_y_, padded_h, 0});
+        this->next_shelf_y_ += padded_h;
+        best = &this->shelves_.back();
+    }
+
+    const Placement placement{best->cursor_x, best->y};
+    best->cursor_x += padded_w;
+    return placement;
+}
+
+std::size_t TextLayoutCache::KeyHash::operator()(const Key& key) const noexcept {
+    const std::size_t text_hash = std::hash<std::string_view>{}(key.text);
+    const std::size_t font_hash = std::hash<FontId>{}(key.font);
+    return text_hash ^ (font_hash + std::size_t{0x9e3779b9} + (text_hash << 6) + (text_hash >> 2));
+}
+
+const TextLayout* TextLayoutCache::find(FontId font, std::string_view text) {
+    const auto it = this->index_.find(Key{font, text});
+    if (it == this->index_.end()) {
+        ++this->stats_.misses;
+        return nullptr;
+    }
+    ++this->stats_.hits;
+    this->entries_.splice(this->entries_.begin(), this->entries_, it->second);
+    return &it->second->layout;
+}
+
+const TextLayout* TextLayoutCache::insert(FontId font, std::string_view text, TextLayout layout) {
+    if (const auto found = this->index_.find(Key{font, text}); found != this->index_.end()) {
+        this->erase(found->second);
+    }
+
+    // 文字列は Entry にだけ持ち、索引はそれを指す
+    const std::size_t bytes = sizeof(Entry) + sizeof(Key) + text.size() + layout.bytes();
+    if (bytes > this->budget_bytes_) return nullptr;
+
+    this->entries_.push_front(Entry{std::string{text}, font, std::move(layout), bytes});
+    const Entry& entry = this->entries_.front();
+    this->index_.emplace(Key{entry.font, entry.text}, this->entries_.begin());
+    this->stats_.bytes += bytes;
+    ++this->stats_.entries;
+    this->evict_to_budget();
+    return &this->entries_.front().layout;
+}
+
+void TextLayoutCache::evict_to_budget() {
+    while (this->stats_.bytes > this->budget_bytes_ && !this->entries_.empty()) {
+        this->erase(std::prev(this->entries_.end()));
+        ++this->stats_.evictions;
+    }
+}
+
+void TextLayoutCache::erase(EntryList::iterator it) {
+    this->stats_.bytes -= it->bytes;
+    --this->stats_.entries;
+    this->index_.erase(Key{it->font, it->text});
+    this->entries_.erase(it);
+}
+
+void TextLayoutCache::erase_font(FontId font) {
+    for (auto it = this->entries_.begin(); it != this->entries_.end();) {
+        const auto next = std::next(it);
+        if (it->font == font) this->erase(it);
+        it = next;
+    }
+}
+
+void TextLayoutCache::clear() {
+    this->entries_.clear();
+    this->index_.clear();
+    this->stats_.entries = 0;
+    this->stats_.bytes = 0;
+}
@@ -1,16 +1,37 @@
+#include <core/Trace.hpp>
 #include <core/scene/IScene.hpp>
 #include <core/scene/InitialScene.hpp>
 #include <core/scene/NextScene.hpp>
 #include <core/scene/SampleSceneGameState.hpp>
+#include <iostream>
+
+namespace {
+constexpr const char* kFontPath = "assets/Noto_Sans_JP/static/NotoSansJP-Regular.ttf";
+constexpr int kFontSize = 24;
+}  // namespace
+
+void InitialScene::initialize(const GameConfig& config, ResourceManager& resources) {
+    // 描画で使うフォントはここで 1 回だけ取得する（render では読み込まない）
+    if (auto font = resources.acquire_font(kFontPath, kFontSize)) {
+        resources_ = &resources;
+        font_ = *font;
+    } else {
+        std::cerr << "Failed to load font: " << font.error() << std::endl;
+    }
+    initialize(config);
+}
 
 void InitialScene::initialize(const GameConfig& config) {
-    // 状態の初期化：100,100 を初期位置とする状態
-    current_state_ = std::make_shared<SampleSceneGameState>(Position{100, 100});
+    // 状態の初期化：100,100 を初期位置とする状態。以降の状態も同じプールから作る
+    state_pool_ = std::make_shared<StatePool>();
+    current_state_ =
+        make_pooled<SampleSceneGameState>(state_pool_, Position{100, 100}, font_, state_pool_);
 }
 
 void InitialScene::update(const double delta_time) {
     if (current_state_ && last_input_) {
         // 状態遷移（関数型）による更新
+        TRACE_SCOPE("scene", "IGameState::step");
         current_state_ = current_state_->step(*last_input_, delta_time);
     }
     if (current_state_ && current_state_->is_ready_to_transition()) {
@@ -21,7 +42,7 @@ void InitialScene::update(const double delta_time) {
 }
 
 void InitialScene::process_input(const Input& input) {
-    last_input_ = std::make_shared<Input>(input);  // immutable input 記録
+    last_input_ = input;  // 値のコピー（ヒープ確保なし）
 }
 
 void InitialScene::render(IRenderer& renderer) {
@@ -30,7 +51,10 @@ void InitialScene::render(IRenderer& renderer) {
 }
 
 void InitialScene::cleanup() {
-    // 特にリソース解放等があればここで実施
+    // 先読みしたフォントを返す（最後の参照ならレンダラから解放される）
+    if (resources_ && font_) resources_->release_font(*font_);
+    font_.reset();
+    resources_ = nullptr;
 }
 
 std::optional<std::unique_ptr<IScene>> InitialScene::take_scene_transition() {
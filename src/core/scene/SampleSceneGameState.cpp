@@ -4,23 +4,34 @@
 #include <iostream>
 #include <utility>  // std::move
 
+// ホールド時間は方向キーの InputKey の値で引く
+static_assert(static_cast<std::size_t>(InputKey::UP) < 4 &&
+              static_cast<std::size_t>(InputKey::DOWN) < 4 &&
+              static_cast<std::size_t>(InputKey::LEFT) < 4 &&
+              static_cast<std::size_t>(InputKey::RIGHT) < 4);
+
 // ─────────────────────────────────────────────
 // コンストラクタ
 // ─────────────────────────────────────────────
 
 // step内で呼び出す想定のコンストラクタ
-SampleSceneGameState::SampleSceneGameState(Position pos, immer::map<InputKey, double> durations,
-                                           bool transition_flag)
-    : position_{pos}, hold_durations_{std::move(durations)}, transition_flag_{transition_flag} {}
+SampleSceneGameState::SampleSceneGameState(Position pos, const HoldDurations& durations,
+                                           bool transition_flag, std::optional<FontId> font,
+                                           std::shared_ptr<StatePool> pool)
+    : position_{pos},
+      hold_durations_{durations},
+      transition_flag_{transition_flag},
+      font_{font},
+      pool_{std::move(pool)} {}
 
 // 初期位置のみを指定するコンストラクタ。シーン開始時に使用されている。
-SampleSceneGameState::SampleSceneGameState(Position pos) : position_{pos} {
-    immer::map<InputKey, double> init_map;
-    for (auto key : {InputKey::LEFT, InputKey::RIGHT, InputKey::UP, InputKey::DOWN}) {
-        init_map = init_map.set(key, 0.0);
-    }
-    hold_durations_ = init_map;
-}
+SampleSceneGameState::SampleSceneGameState(Position pos, std::optional<FontId> font,
+                                           std::shared_ptr<StatePool> pool)
+    : position_{pos},
+      hold_durations_{},
+      transition_flag_{false},
+      font_{font},
+      pool_{std::move(pool)} {}
 
 // ─────────────────────────────────────────────
 // 状態遷移 (純粋関数)
@@ -32,20 +43,15 @@ std::shared_ptr<const IGameState> SampleSceneGameState::step(const Input& input,
     constexpr double step_px = 10.0;       // 1 ステップで動く距離 [px]
 
     // コピーして新しい値オブジェクトを作る
-    auto updated_hold_durations = hold_durations_;
+    HoldDurations updated_hold_durations = hold_durations_;
     Position new_position = position_;
     bool new_transition_flag = transition_flag_;
 
     // ── 入力キーごとの処理 ─────────────────────
     for (auto key : {InputKey::LEFT, InputKey::RIGHT, InputKey::UP, InputKey::DOWN}) {
-        const auto it = input.key_states.find(key);
-        if (it == input.key_states.end()) {
-            updated_hold_durations = updated_hold_durations.set(key, 0.0);  // イミュータブル更新
-            continue;
-        }
-
-        const auto& st = it->second;
-        double prev_duration = hold_durations_.find(key) ? *hold_durations_.find(key) : 0.0;
+        const InputState st = input.state_of(key);
+        const auto index = static_cast<std::size_t>(key);
+        double prev_duration = hold_durations_[index];
         double new_duration = st.is_held || st.is_pressed ? prev_duration + delta_time : 0.0;
 
         bool should_move = (st.is_pressed && new_duration >= 0.0) ||
@@ -71,7 +77,7 @@ std::shared_ptr<const IGameState> SampleSceneGameState::step(const Input& input,
             }
         }
 
-        updated_hold_durations = updated_hold_durations.set(key, new_duration);
+        updated_hold_durations[index] = new_duration;
     }
 
     // シーン遷移判定
@@ -79,9 +85,17 @@ std::shared_ptr<const IGameState> SampleSceneGameState::step(const Input& input,
         new_transition_flag = true;
     }
 
+    // 何も変わらなければ同じ状態を使い回す（shared_ptr で所有されていない場合だけ作り直す）
+    const bool unchanged = new_position.x == position_.x && new_position.y == position_.y &&
+                           updated_hold_durations == hold_durations_ &&
+                           new_transition_flag == transition_flag_;
+    if (unchanged) {
+        if (auto self = weak_from_this().lock()) return self;
+    }
+
     // 更新用コンストラクタに変わる
-    return std::make_shared<SampleSceneGameState>(new_position, std::move(updated_hold_durations),
-                                                  new_transition_flag);
+    return make_pooled<SampleSceneGameState>(pool_, new_position, updated_hold_durations,
+                                             new_transition_flag, font_, pool_);
 }
 
 // ─────────────────────────────────────────────
@@ -93,12 +107,9 @@ void SampleSceneGameState::render(IRenderer& renderer) const {
 
     renderer.fill_rect(rect, blue);
 
-    auto font_id = renderer.register_font("assets/Noto_Sans_JP/static/NotoSansJP-Regular.ttf", 24);
-
-    if (font_id) {
-        auto font_id_value = font_id.value();
-        auto result =
-            renderer.draw_text(font_id_value, "Sample Scene", {100, 100}, {255, 255, 255, 255});
+    // フォントはシーンの initialize で先読み済み。ここでは読み込まない
+    if (font_) {
+        auto result = renderer.draw_text(*font_, "Sample Scene", {100, 100}, {255, 255, 255, 255});
         if (!result) {
             std::cerr << "Failed to draw text: " << result.error() << std::endl;
         }
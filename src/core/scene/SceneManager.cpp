@@ -1,7 +1,9 @@
 #include <cassert>
+#include <core/Trace.hpp>
 #include <core/scene/SceneManager.hpp>
 
 void SceneManager::update(const double delta_time) {
+    TRACE_SCOPE("scene", "SceneManager::update");
     assert(current_scene_);
     current_scene_->update(delta_time);
 
@@ -19,6 +21,11 @@ void SceneManager::render(IRenderer& renderer) {
     current_scene_->render(renderer);
 }
 
+void SceneManager::render(IRenderer& renderer, double alpha) {
+    assert(current_scene_);
+    current_scene_->render(renderer, alpha);
+}
+
 void SceneManager::process_input(const Input& input) {
     assert(current_scene_);
     current_scene_->process_input(input);
@@ -38,16 +45,31 @@ IScene& SceneManager::get_current() const {
 
 void SceneManager::apply_scene_change() {
     if (!next_scene_) return;  // 遷移要求なし
+    TRACE_SCOPE("scene", "SceneManager::apply_scene_change");
 
-    // 現シーンの後処理
-    current_scene_->cleanup();
-
-    // 所有権をスワップ
+    // 所有権をスワップ。前のシーンは次のシーンの初期化が終わるまで残す
+    std::unique_ptr<IScene> previous = std::move(current_scene_);
     current_scene_ = std::move(next_scene_);
     next_scene_.reset();
 
     // 新シーンの初期化。関数呼び出しで渡しているのでコンストラクタで受け取らなくてOK。
     // コンストラクタの煩雑なオーバーロードを廃し、GameConfigに依存する初期化処理を閉じ込める目的がある。
     // 必要に応じてISceneはGameConfigをメンバ変数として保存できるが、非推奨。(しかし、型として明示されるため、依存関係が分かりやすくなっている)
-    current_scene_->initialize(*game_config_);
+    initialize_current();
+
+    // 前シーンの後処理は新シーンがリソースを取得した後に行う。
+    // 両方のシーンで使うフォント・テクスチャは参照が 0 にならず、解放・再読み込みされない
+    {
+        TRACE_SCOPE("scene", "IScene::cleanup");
+        previous->cleanup();
+    }
+}
+
+void SceneManager::initialize_current() {
+    TRACE_SCOPE("scene", "IScene::initialize");
+    if (resources_) {
+        current_scene_->initialize(*game_config_, *resources_);
+    } else {
+        current_scene_->initialize(*game_config_);
+    }
 }
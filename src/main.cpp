@@ -2,11 +2,17 @@
 #include <emscripten.h>
 #include <core/Game.hpp>
 #include <core/GameConfig.hpp>
+#include <core/ResourceManager.hpp>
+#include <core/Trace.hpp>
 #include <core/scene/InitialScene.hpp>
 #include <core/scene/SceneManager.hpp>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <sdl/SDLRenderer.hpp>
+#ifndef __EMSCRIPTEN__
+#include <core/render/PipelinedRenderer.hpp>  // 描画スレッドはネイティブ限定
+#endif
 
 std::unique_ptr<Game> g_game;  // グローバル保持
 SDL_Window* window;            // ←重複定義を避ける
@@ -23,6 +29,10 @@ extern "C" void frame_cb(void* arg) {
 #endif
 
 int main() {
+#if TETRIS_TRACE && !defined(__EMSCRIPTEN__)
+    // 終了時にタイムラインを書き出す（Perfetto / chrome://tracing で開く）
+    trace::flush_at_exit("tetris_trace.json");
+#endif
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
         std::cerr << "SDL_Init Error: " << SDL_GetError() << '\n';
         return 1;
@@ -43,8 +53,30 @@ int main() {
     }
 
     // ── Renderer ──
-    auto renderer_result =
-        SDLRenderer::create(window, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    const auto create_sdl_renderer = []() -> tl::expected<std::unique_ptr<IRenderer>, std::string> {
+        auto created =
+            SDLRenderer::create(window, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+        if (!created) return tl::unexpected(created.error());
+        return std::unique_ptr<IRenderer>{std::move(*created)};
+    };
+    tl::expected<std::unique_ptr<IRenderer>, std::string> renderer_result;
+#ifndef __EMSCRIPTEN__
+    if (std::getenv("TETRIS_PIPELINED_RENDER")) {
+        // 描画と Present を専用スレッドに移し、ロジックのティックを Present の待ちから切り離す
+        auto pipelined = PipelinedRenderer::create(
+            create_sdl_renderer, game_config::defaultGameConfig.window.width,
+            game_config::defaultGameConfig.window.height);
+        if (pipelined) {
+            renderer_result = std::unique_ptr<IRenderer>{std::move(*pipelined)};
+        } else {
+            renderer_result = tl::unexpected(pipelined.error());
+        }
+    } else {
+        renderer_result = create_sdl_renderer();
+    }
+#else
+    renderer_result = create_sdl_renderer();
+#endif
     if (!renderer_result) {
         std::cerr << renderer_result.error() << '\n';
         return 1;
@@ -52,9 +84,12 @@ int main() {
     auto renderer = std::move(renderer_result.value());
     auto game_config = std::make_shared<const GameConfig>(game_config::defaultGameConfig);
 
+    // ── ResourceManager ──（フォント等を (パス, サイズ) ごとに 1 回だけ読み込む）
+    auto resources = std::make_shared<ResourceManager>(*renderer);
+
     // ── SceneManager ──
     auto scene_manager =
-        std::make_unique<SceneManager>(std::make_unique<InitialScene>(), game_config);
+        std::make_unique<SceneManager>(std::make_unique<InitialScene>(), game_config, resources);
 
     // ── InputPoller ──
     auto input_poller = std::make_unique<SDLInputPoller>();
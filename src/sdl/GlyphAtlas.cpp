@@ -0,0 +1,109 @@
+#include <core/Trace.hpp>
+#include <sdl/GlyphAtlas.hpp>
+#include <utility>
+#include <vector>
+
+tl::expected<std::unique_ptr<GlyphAtlas>, std::string> GlyphAtlas::create(SDL_Renderer* renderer,
+                                                                          TTF_Font* font,
+                                                                          int size) {
+    if (!renderer || !font) {
+        return tl::unexpected<std::string>{"GlyphAtlas: renderer and font must not be null"};
+    }
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
+                                             SDL_TEXTUREACCESS_STATIC, size, size);
+    if (!texture) {
+        return tl::unexpected<std::string>(std::string{"GlyphAtlas: SDL_CreateTexture failed: "} +
+                                           SDL_GetError());
+    }
+    // 作ったばかりのテクスチャの中身は不定。グリフの隙間（padding）を線形補間で拾っても
+    // にじまないように透明で埋めておく
+    const std::vector<Uint32> transparent(static_cast<std::size_t>(size) * size, 0);
+    if (SDL_UpdateTexture(texture, nullptr, transparent.data(),
+                          size * static_cast<int>(sizeof(Uint32))) != 0) {
+        std::string error = std::string{"GlyphAtlas: SDL_UpdateTexture failed: "} + SDL_GetError();
+        SDL_DestroyTexture(texture);
+        return tl::unexpected<std::string>(std::move(error));
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return std::unique_ptr<GlyphAtlas>{new GlyphAtlas{renderer, font, texture, size}};
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    if (texture_) SDL_DestroyTexture(texture_);
+}
+
+void GlyphAtlas::reset() {
+    this->packer_.reset();
+    this->glyphs_.clear();
+    ++this->generation_;
+}
+
+std::optional<GlyphAtlas::Glyph> GlyphAtlas::rasterize(char32_t code) {
+    TRACE_SCOPE("renderer", "GlyphAtlas::rasterize");
+    int advance = 0;
+    if (TTF_GlyphMetrics32(font_, static_cast<Uint32>(code), nullptr, nullptr, nullptr, nullptr,
+                           &advance) != 0) {
+        advance = 0;
+    }
+
+    // 白で描き、色は頂点色で乗せる。描画面は行の高さぶんあり、ベースラインの位置は揃っている
+    SDL_Surface* rendered =
+        TTF_RenderGlyph32_Blended(font_, static_cast<Uint32>(code), SDL_Color{255, 255, 255, 255});
+    if (!rendered) return Glyph{0, 0, 0, 0, advance};  // 空白など描くものがないグリフ
+
+    SDL_Surface* surface = SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(rendered);
+    if (!surface) return Glyph{0, 0, 0, 0, advance};
+
+    const auto placement = this->packer_.insert(surface->w, surface->h);
+    if (!placement) {
+        SDL_FreeSurface(surface);
+        return std::nullopt;
+    }
+    const Glyph glyph{placement->x, placement->y, surface->w, surface->h, advance};
+    const SDL_Rect region{glyph.x, glyph.y, glyph.width, glyph.height};
+    if (glyph.width > 0 && glyph.height > 0) {
+        SDL_UpdateTexture(texture_, &region, surface->pixels, surface->pitch);
+    }
+    SDL_FreeSurface(surface);
+    return glyph;
+}
+
+const GlyphAtlas::Glyph& GlyphAtlas::glyph(char32_t code) {
+    if (const auto it = this->glyphs_.find(code); it != this->glyphs_.end()) return it->second;
+
+    auto rasterized = this->rasterize(code);
+    if (!rasterized) {
+        // 一杯。空にしてから詰め直す（それでも入らない巨大なグリフは描かない）
+        this->reset();
+        rasterized = this->rasterize(code);
+        if (!rasterized) {
+            int advance = 0;
+            TTF_GlyphMetrics32(font_, static_cast<Uint32>(code), nullptr, nullptr, nullptr,
+                               nullptr, &advance);
+            rasterized = Glyph{0, 0, 0, 0, advance};
+        }
+    }
+    return this->glyphs_.emplace(code, *rasterized).first->second;
+}
+
+std::optional<TextLayout> GlyphAtlas::layout(std::string_view utf8) {
+    TRACE_SCOPE("renderer", "GlyphAtlas::layout");
+    this->codepoints_.clear();
+    decode_utf8(utf8, this->codepoints_);
+
+    // layout_glyphs から見たこのアトラス（フォントの寸法と、足りないグリフのラスタライズ）
+    struct Source {
+        GlyphAtlas& atlas;
+
+        [[nodiscard]] std::uint32_t generation() const noexcept { return atlas.generation_; }
+        [[nodiscard]] int line_height() const { return TTF_FontHeight(atlas.font_); }
+        [[nodiscard]] int kerning(char32_t previous, char32_t code) const {
+            return TTF_GetFontKerningSizeGlyphs32(atlas.font_, static_cast<Uint32>(previous),
+                                                  static_cast<Uint32>(code));
+        }
+        const Glyph& glyph(char32_t code) { return atlas.glyph(code); }
+    };
+    Source source{*this};
+    return layout_glyphs(source, this->codepoints_);
+}
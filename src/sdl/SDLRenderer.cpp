@@ -1,8 +1,12 @@
 #include <SDL2/SDL_ttf.h>
+#include <core/Trace.hpp>
+#include <optional>
 #include <sdl/SDLRenderer.hpp>
+#include <utility>
 
 // ──────────── ローカル変換ユーティリティ ────────────
 namespace {
+/// 矩形をピクセルに揃える規則はこの関数だけ（座標・サイズとも 0 方向への切り捨て）
 inline SDL_Rect to_sdl_rect(const Rect& r) {
     return SDL_Rect{static_cast<int>(r.pos.x), static_cast<int>(r.pos.y),
                     static_cast<int>(r.size.width), static_cast<int>(r.size.height)};
@@ -36,7 +40,8 @@ SDLRenderer::~SDLRenderer() {
     for (auto& [id, tex] : textures_) SDL_DestroyTexture(tex);
     textures_.clear();
 
-    // フォント解放
+    // フォント解放（アトラスはフォントを借用しているので先に捨てる）
+    atlases_.clear();
     for (auto& [id, font] : fonts_) TTF_CloseFont(font);
     fonts_.clear();
 
@@ -54,28 +59,91 @@ void SDLRenderer::begin_frame() {
        状態リセットや ImGui 等の前処理を挟む場合に利用 */
 }
 
-void SDLRenderer::end_frame() { SDL_RenderPresent(renderer_); }
+void SDLRenderer::end_frame() {
+    TRACE_SCOPE("renderer", "SDLRenderer::end_frame");  // 垂直同期の待ちを含む
+    SDL_RenderPresent(renderer_);
+}
+
+bool SDLRenderer::set_vsync(bool enabled) {
+    // SDL 2.0.18 以降。生成時の SDL_RENDERER_PRESENTVSYNC を実行時に切り替える
+    return SDL_RenderSetVSync(renderer_, enabled ? 1 : 0) == 0;
+}
 
 // ──────────── 画面クリア ────────────
 void SDLRenderer::clear(Color color) {
+    TRACE_SCOPE("renderer", "SDLRenderer::clear");
     set_draw_color(color);
     SDL_RenderClear(renderer_);
 }
 
 // ──────────── プリミティブ描画 ────────────
 void SDLRenderer::fill_rect(const Rect& rect, Color color) {
+    TRACE_SCOPE("renderer", "SDLRenderer::fill_rect");
     set_draw_color(color);
     SDL_Rect srect = to_sdl_rect(rect);
     SDL_RenderFillRect(renderer_, &srect);
 }
 
 void SDLRenderer::stroke_rect(const Rect& rect, Color color) {
+    TRACE_SCOPE("renderer", "SDLRenderer::stroke_rect");
     set_draw_color(color);
     SDL_Rect srect = to_sdl_rect(rect);
     SDL_RenderDrawRect(renderer_, &srect);
 }
 
+void SDLRenderer::fill_rects(const ColoredRect* rects, std::size_t count) {
+    TRACE_SCOPE("renderer", "SDLRenderer::fill_rects");
+    if (count == 0) return;
+
+    // 矩形ごとに頂点 4 つ・インデックス 6 つ。色は頂点色で渡すので色替えの呼び出しが要らない
+    batch_vertices_.resize(count * 4);
+    batch_indices_.resize(count * 6);
+    for (std::size_t i = 0; i < count; ++i) {
+        // fill_rect（とフォールバック）と同じ整数の矩形に揃えてから頂点にする
+        const SDL_Rect r = to_sdl_rect(rects[i].rect);
+        const Color& c = rects[i].color;
+        const SDL_Color color{c.r, c.g, c.b, c.a};
+        const auto left = static_cast<float>(r.x);
+        const auto top = static_cast<float>(r.y);
+        const auto right = static_cast<float>(r.x + r.w);
+        const auto bottom = static_cast<float>(r.y + r.h);
+
+        SDL_Vertex* v = &batch_vertices_[i * 4];
+        v[0] = SDL_Vertex{SDL_FPoint{left, top}, color, SDL_FPoint{0.0f, 0.0f}};
+        v[1] = SDL_Vertex{SDL_FPoint{right, top}, color, SDL_FPoint{0.0f, 0.0f}};
+        v[2] = SDL_Vertex{SDL_FPoint{right, bottom}, color, SDL_FPoint{0.0f, 0.0f}};
+        v[3] = SDL_Vertex{SDL_FPoint{left, bottom}, color, SDL_FPoint{0.0f, 0.0f}};
+
+        const int base = static_cast<int>(i * 4);
+        int* index = &batch_indices_[i * 6];
+        index[0] = base;
+        index[1] = base + 1;
+        index[2] = base + 2;
+        index[3] = base;
+        index[4] = base + 2;
+        index[5] = base + 3;
+    }
+
+    if (SDL_RenderGeometry(renderer_, nullptr, batch_vertices_.data(),
+                           static_cast<int>(batch_vertices_.size()), batch_indices_.data(),
+                           static_cast<int>(batch_indices_.size())) != 0) {
+        // SDL_RenderGeometry を使えないバックエンドでは 1 枚ずつ塗る
+        IRenderer::fill_rects(rects, count);
+    }
+}
+
+void SDLRenderer::stroke_rects(const Rect* rects, std::size_t count, Color color) {
+    TRACE_SCOPE("renderer", "SDLRenderer::stroke_rects");
+    if (count == 0) return;
+
+    batch_rects_.resize(count);
+    for (std::size_t i = 0; i < count; ++i) batch_rects_[i] = to_sdl_rect(rects[i]);
+    set_draw_color(color);
+    SDL_RenderDrawRects(renderer_, batch_rects_.data(), static_cast<int>(count));
+}
+
 void SDLRenderer::draw_line(Position start, Position end, Color color) {
+    TRACE_SCOPE("renderer", "SDLRenderer::draw_line");
     set_draw_color(color);
     SDL_RenderDrawLine(renderer_, static_cast<int>(start.x), static_cast<int>(start.y),
                        static_cast<int>(end.x), static_cast<int>(end.y));
@@ -83,6 +151,7 @@ void SDLRenderer::draw_line(Position start, Position end, Color color) {
 
 void SDLRenderer::draw_texture(TextureId id, const Rect& src_region, const Rect& dst_region,
                                double angle) {
+    TRACE_SCOPE("renderer", "SDLRenderer::draw_texture");
     auto it = textures_.find(id);
     if (it == textures_.end()) return;  // 未登録 ID は無視（必要ならエラーを返す API を追加）
 
@@ -103,27 +172,159 @@ tl::expected<TextureId, std::string> SDLRenderer::register_texture(SDL_Texture*
     return id;
 }
 
+// ──────────── オフスクリーン描画 ────────────
+tl::expected<TextureId, std::string> SDLRenderer::create_render_target(int width, int height) {
+    SDL_Texture* tex = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888,
+                                         SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!tex) {
+        return tl::unexpected<std::string>(std::string{"SDL_CreateTexture failed: "} +
+                                           SDL_GetError());
+    }
+    return register_texture(tex);
+}
+
+bool SDLRenderer::set_render_target(std::optional<TextureId> target) {
+    if (!target) return SDL_SetRenderTarget(renderer_, nullptr) == 0;
+    auto it = textures_.find(*target);
+    if (it == textures_.end()) return false;
+    return SDL_SetRenderTarget(renderer_, it->second) == 0;
+}
+
+void SDLRenderer::release_texture(TextureId id) {
+    auto it = textures_.find(id);
+    if (it == textures_.end()) return;
+    SDL_DestroyTexture(it->second);
+    textures_.erase(it);
+}
+
+tl::expected<TextureId, std::string> SDLRenderer::load_texture(const std::string& path) {
+    TRACE_SCOPE("renderer", "SDLRenderer::load_texture");
+    SDL_Surface* surface = SDL_LoadBMP(path.c_str());
+    if (!surface) {
+        return tl::unexpected<std::string>(std::string{"SDL_LoadBMP failed: "} + SDL_GetError());
+    }
+    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer_, surface);
+    SDL_FreeSurface(surface);
+    if (!tex) {
+        return tl::unexpected<std::string>(std::string{"SDL_CreateTextureFromSurface failed: "} +
+                                           SDL_GetError());
+    }
+    return register_texture(tex);
+}
+
 // ──────────── フォント管理 ────────────
 tl::expected<FontId, std::string> SDLRenderer::register_font(const std::string& path, int pt_size) {
+    TRACE_SCOPE("renderer", "SDLRenderer::register_font");
     TTF_Font* font = TTF_OpenFont(path.c_str(), pt_size);
     if (!font) {
         return tl::unexpected<std::string>(std::string{"TTF_OpenFont failed: "} + TTF_GetError());
     }
     const FontId id = next_font_id_++;
     fonts_.emplace(id, font);
+    // アトラスを作れなければ、このフォントは毎回ラスタライズする経路で描く
+    if (auto atlas = GlyphAtlas::create(renderer_, font)) atlases_.emplace(id, std::move(*atlas));
     return id;
 }
 
+void SDLRenderer::release_font(FontId id) {
+    auto it = fonts_.find(id);
+    if (it == fonts_.end()) return;
+    // アトラスはフォントを借用しているので先に捨てる
+    atlases_.erase(id);
+    layout_cache_.erase_font(id);
+    TTF_CloseFont(it->second);
+    fonts_.erase(it);
+}
+
 // ──────────── テキスト描画 ────────────
 tl::expected<void, std::string> SDLRenderer::draw_text(FontId font_id, const std::string& utf8,
                                                        Position pos, Color color) {
+    TRACE_SCOPE("renderer", "SDLRenderer::draw_text");
     auto it = fonts_.find(font_id);
     if (it == fonts_.end()) {
         return tl::unexpected<std::string>{"draw_text: invalid font_id"};
     }
 
+    auto atlas_it = atlases_.find(font_id);
+    if (atlas_it == atlases_.end()) return draw_text_uncached(it->second, utf8, pos, color);
+    GlyphAtlas& atlas = *atlas_it->second;
+
+    if (const TextLayout* cached = layout_cache_.find(font_id, utf8)) {
+        if (draw_glyph_quads(atlas, *cached, pos, color)) return {};
+        // SDL_RenderGeometry を使えないバックエンドでは 1 回ごとにラスタライズして描く
+        return draw_text_uncached(it->second, utf8, pos, color);
+    }
+
+    const std::uint32_t generation = atlas.generation();
+    std::optional<TextLayout> layout = atlas.layout(utf8);
+    if (atlas.generation() != generation) {
+        // アトラスを作り直したら、このフォントの既存レイアウトの座標は無効。作り直しを挟んだ
+        // レイアウトも登録せず、このフレームはアトラスを使わずに描く（次のフレームで登録し直す）
+        layout_cache_.erase_font(font_id);
+        return draw_text_uncached(it->second, utf8, pos, color);
+    }
+    if (!layout) return draw_text_uncached(it->second, utf8, pos, color);
+    const auto drawn = draw_glyph_quads(atlas, *layout, pos, color);
+    layout_cache_.insert(font_id, utf8, std::move(*layout));
+    if (!drawn) return draw_text_uncached(it->second, utf8, pos, color);
+    return {};
+}
+
+tl::expected<void, std::string> SDLRenderer::draw_glyph_quads(const GlyphAtlas& atlas,
+                                                              const TextLayout& layout,
+                                                              Position pos, Color color) {
+    if (layout.quads.empty()) return {};
+
+    int atlas_w = 0;
+    int atlas_h = 0;
+    SDL_QueryTexture(atlas.texture(), nullptr, nullptr, &atlas_w, &atlas_h);
+    const float inv_w = 1.0f / static_cast<float>(atlas_w);
+    const float inv_h = 1.0f / static_cast<float>(atlas_h);
+    const SDL_Color tint{color.r, color.g, color.b, color.a};
+    const auto origin_x = static_cast<float>(pos.x);
+    const auto origin_y = static_cast<float>(pos.y);
+
+    const std::size_t count = layout.quads.size();
+    batch_vertices_.resize(count * 4);
+    batch_indices_.resize(count * 6);
+    for (std::size_t i = 0; i < count; ++i) {
+        const GlyphQuad& q = layout.quads[i];
+        const float left = origin_x + q.dst_x;
+        const float top = origin_y + q.dst_y;
+        const float u0 = q.src_x * inv_w;
+        const float v0 = q.src_y * inv_h;
+        const float u1 = (q.src_x + q.width) * inv_w;
+        const float v1 = (q.src_y + q.height) * inv_h;
+
+        SDL_Vertex* v = &batch_vertices_[i * 4];
+        v[0] = SDL_Vertex{SDL_FPoint{left, top}, tint, SDL_FPoint{u0, v0}};
+        v[1] = SDL_Vertex{SDL_FPoint{left + q.width, top}, tint, SDL_FPoint{u1, v0}};
+        v[2] = SDL_Vertex{SDL_FPoint{left + q.width, top + q.height}, tint, SDL_FPoint{u1, v1}};
+        v[3] = SDL_Vertex{SDL_FPoint{left, top + q.height}, tint, SDL_FPoint{u0, v1}};
+
+        const int base = static_cast<int>(i * 4);
+        int* index = &batch_indices_[i * 6];
+        index[0] = base;
+        index[1] = base + 1;
+        index[2] = base + 2;
+        index[3] = base;
+        index[4] = base + 2;
+        index[5] = base + 3;
+    }
+    if (SDL_RenderGeometry(renderer_, atlas.texture(), batch_vertices_.data(),
+                           static_cast<int>(batch_vertices_.size()), batch_indices_.data(),
+                           static_cast<int>(batch_indices_.size())) != 0) {
+        return tl::unexpected<std::string>(std::string{"SDL_RenderGeometry failed: "} +
+                                           SDL_GetError());
+    }
+    return {};
+}
+
+tl::expected<void, std::string> SDLRenderer::draw_text_uncached(TTF_Font* font,
+                                                                const std::string& utf8,
+                                                                Position pos, Color color) {
     SDL_Color fg{color.r, color.g, color.b, color.a};
-    SDL_Surface* surface = TTF_RenderUTF8_Blended(it->second, utf8.c_str(), fg);
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, utf8.c_str(), fg);
     if (!surface) {
         return tl::unexpected<std::string>(std::string{"TTF_RenderUTF8_Blended failed: "} +
                                            TTF_GetError());
@@ -0,0 +1,20 @@
+// test/allocation/allocation_counter.hpp
+// allocation_tests 専用。このバイナリでは counting_new.cpp が operator new / delete を置き換える
+#ifndef EBE31734_12F3_4791_9D8F_3FF0D4158C0F
+#define EBE31734_12F3_4791_9D8F_3FF0D4158C0F
+
+#include <cstddef>
+
+/// 生きている間、このスレッドの operator new（全形式）の呼び出しを数える
+class AllocationCounter {
+   public:
+    AllocationCounter() noexcept;
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    [[nodiscard]] std::size_t count() const noexcept;
+};
+
+#endif /* EBE31734_12F3_4791_9D8F_3FF0D4158C0F */
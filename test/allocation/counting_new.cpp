@@ -0,0 +1,83 @@
+// test/allocation/counting_new.cpp
+// allocation_tests のグローバルな operator new / delete の置き換え
+//   - 通常・配列・nothrow・サイズ付き・アライン指定の全形式を malloc / free で揃えて置き換える
+//     （一部だけ置き換えると、置き換えていない形式と確保・解放の組み合わせが食い違う）
+//   - all_tests には入れない。ほかのテストの確保の仕方を変えないよう、専用のバイナリに閉じる
+#include <cstdlib>
+#include <new>
+#include "allocation_counter.hpp"
+
+namespace {
+thread_local bool t_counting = false;  ///< 計数するのは計測中のスレッドだけ
+thread_local std::size_t t_allocations = 0;
+
+void* allocate(std::size_t size) noexcept {
+    if (t_counting) ++t_allocations;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* allocate_aligned(std::size_t size, std::align_val_t alignment) noexcept {
+    if (t_counting) ++t_allocations;
+    const auto align = static_cast<std::size_t>(alignment);
+    // aligned_alloc の大きさはアラインメントの倍数でなければならない
+    const std::size_t bytes = size == 0 ? 1 : size;
+    const std::size_t rounded = (bytes + align - 1) / align * align;
+    return std::aligned_alloc(align, rounded);
+}
+
+void* allocate_or_throw(std::size_t size) {
+    if (void* p = allocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* allocate_aligned_or_throw(std::size_t size, std::align_val_t alignment) {
+    if (void* p = allocate_aligned(size, alignment)) return p;
+    throw std::bad_alloc();
+}
+}  // namespace
+
+AllocationCounter::AllocationCounter() noexcept {
+    t_allocations = 0;
+    t_counting = true;
+}
+
+AllocationCounter::~AllocationCounter() { t_counting = false; }
+
+std::size_t AllocationCounter::count() const noexcept { return t_allocations; }
+
+// ──────────── 確保 ────────────
+void* operator new(std::size_t size) { return allocate_or_throw(size); }
+void* operator new[](std::size_t size) { return allocate_or_throw(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocate_aligned_or_throw(size, alignment);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocate_aligned_or_throw(size, alignment);
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate_aligned(size, alignment);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+    return allocate_aligned(size, alignment);
+}
+
+// ──────────── 解放（どの形式も free で返す） ────────────
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
@@ -0,0 +1,56 @@
+// test/allocation/steady_state_allocation_test.cpp
+// 定常状態のフレームがヒープ確保をしないことを、operator new の呼び出し回数で確かめる
+//   - allocation_tests（counting_new.cpp で operator new を置き換えたバイナリ）でだけ動く
+#include <gtest/gtest.h>
+#include <core/GameConfig.hpp>
+#include <core/render/RecordingRenderer.hpp>
+#include <core/scene/InitialScene.hpp>
+#include "allocation_counter.hpp"
+
+namespace {
+Input holding(InputKey key, bool first_frame) {
+    Input input;
+    if (first_frame) input.key_down(key);
+    input.held |= Input::bit_of(key);
+    return input;
+}
+
+/// 1 フレーム分（入力 → 更新 → 描画）を回す
+void run_frame(InitialScene& scene, RecordingRenderer& recorder, const Input& input) {
+    scene.process_input(input);
+    scene.update(1.0 / 60.0);
+    recorder.clear_commands();
+    scene.render(recorder);
+}
+}  // namespace
+
+TEST(SteadyStateAllocationTest, FramesDoNotAllocate) {
+    InitialScene scene;
+    scene.initialize(game_config::defaultGameConfig);
+    RecordingRenderer recorder(game_config::defaultGameConfig.window.width,
+                               game_config::defaultGameConfig.window.height);
+
+    // 温める: プールのブロックと命令列の容量がここで確保される
+    for (int frame = 0; frame < 30; ++frame) {
+        run_frame(scene, recorder, holding(InputKey::DOWN, frame == 0));
+    }
+
+    std::size_t held_allocations = 0;
+    {
+        const AllocationCounter counter;
+        for (int frame = 0; frame < 120; ++frame) {
+            run_frame(scene, recorder, holding(InputKey::DOWN, false));  // 毎フレーム状態が変わる
+        }
+        held_allocations = counter.count();
+    }
+    EXPECT_EQ(held_allocations, 0u);
+
+    std::size_t idle_allocations = 0;
+    {
+        const AllocationCounter counter;
+        for (int frame = 0; frame < 120; ++frame) run_frame(scene, recorder, Input{});
+        idle_allocations = counter.count();
+    }
+    EXPECT_EQ(idle_allocations, 0u);
+    EXPECT_FALSE(scene.take_scene_transition());
+}
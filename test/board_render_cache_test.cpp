@@ -0,0 +1,123 @@
+// test/board_render_cache_test.cpp
+#include <gtest/gtest.h>
+#include <core/GameConfig.hpp>
+#include <core/render/BoardRenderCache.hpp>
+#include <vector>
+#include "test_support.hpp"
+
+namespace {
+// 描画先テクスチャに対応し、画面とテクスチャそれぞれへのセル描画数を数えるレンダラ
+class TargetRenderer final : public test_support::NullRenderer {
+   public:
+    bool supports_targets = true;
+    bool on_target = false;
+    std::size_t target_cells = 0;  ///< テクスチャに描いたセル（塗り＋枠線）
+    std::size_t screen_cells = 0;  ///< 画面に直接描いたセル
+    int composites = 0;
+    int created = 0;
+    int released = 0;
+
+    void fill_rect(const Rect&, Color) override { count(1); }
+    void stroke_rect(const Rect&, Color) override { count(1); }
+    void draw_texture(TextureId, const Rect&, const Rect&, double) override { ++composites; }
+    void fill_rects(const ColoredRect* rects, std::size_t n) override {
+        // 下地の塗りつぶし（黒）はセルに数えない
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!color_parser::same_color(rects[i].color, BoardRenderCache::kBackground)) count(1);
+        }
+    }
+    void stroke_rects(const Rect*, std::size_t n, Color) override { count(n); }
+    tl::expected<TextureId, std::string> create_render_target(int, int) override {
+        if (!supports_targets) return tl::unexpected<std::string>{"unsupported"};
+        ++created;
+        return TextureId{7};
+    }
+    bool set_render_target(std::optional<TextureId> target) override {
+        on_target = target.has_value();
+        return true;
+    }
+    void release_texture(TextureId) override { ++released; }
+
+    void reset_counts() {
+        target_cells = 0;
+        screen_cells = 0;
+        composites = 0;
+    }
+
+   private:
+    void count(std::size_t n) { (on_target ? target_cells : screen_cells) += n; }
+};
+}  // namespace
+
+using test_support::fill;
+using test_support::make_grid;
+
+TEST(BoardRenderCacheTest, FirstFrameDrawsEveryRowIntoTheTarget) {
+    const TetrisGrid grid = make_grid();
+    TargetRenderer renderer;
+    BoardRenderCache cache;
+    cache.render(renderer, grid);
+
+    EXPECT_TRUE(cache.is_cached());
+    EXPECT_EQ(cache.last_redrawn_rows(), grid.all_rows());
+    EXPECT_EQ(renderer.target_cells,
+              static_cast<std::size_t>(grid.grid_size.row * grid.grid_size.column));
+    EXPECT_EQ(renderer.screen_cells, 0u);
+    EXPECT_EQ(renderer.composites, 1);
+}
+
+TEST(BoardRenderCacheTest, UnchangedGridOnlyComposites) {
+    const TetrisGrid grid = make_grid();
+    TargetRenderer renderer;
+    BoardRenderCache cache;
+    cache.render(renderer, grid);
+    renderer.reset_counts();
+
+    cache.render(renderer, grid);
+    EXPECT_EQ(cache.last_redrawn_rows(), 0u);
+    EXPECT_EQ(renderer.target_cells, 0u);
+    EXPECT_EQ(renderer.composites, 1);
+    EXPECT_EQ(renderer.created, 1);
+}
+
+TEST(BoardRenderCacheTest, OnlyChangedRowsAreRedrawn) {
+    const TetrisGrid grid = make_grid();
+    TargetRenderer renderer;
+    BoardRenderCache cache;
+    cache.render(renderer, grid);
+    renderer.reset_counts();
+
+    const TetrisGrid next = fill(fill(grid, {3, 19}), {4, 7});
+    cache.render(renderer, next);
+    EXPECT_EQ(cache.last_redrawn_rows(), (TetrisGrid::RowMask{1} << 19) | (1u << 7));
+    EXPECT_EQ(renderer.target_cells, static_cast<std::size_t>(2 * grid.grid_size.column));
+    EXPECT_EQ(renderer.screen_cells, 0u);
+}
+
+TEST(BoardRenderCacheTest, InvalidateRedrawsEverything) {
+    const TetrisGrid grid = make_grid();
+    TargetRenderer renderer;
+    BoardRenderCache cache;
+    cache.render(renderer, grid);
+    cache.invalidate();
+    cache.render(renderer, grid);
+    EXPECT_EQ(cache.last_redrawn_rows(), grid.all_rows());
+
+    cache.release(renderer);
+    EXPECT_EQ(renderer.released, 1);
+    EXPECT_FALSE(cache.is_cached());
+}
+
+TEST(BoardRenderCacheTest, FallsBackWithoutRenderTargets) {
+    const TetrisGrid grid = make_grid();
+    TargetRenderer renderer;
+    renderer.supports_targets = false;
+    BoardRenderCache cache;
+    cache.render(renderer, grid);
+    cache.render(renderer, grid);
+
+    EXPECT_FALSE(cache.is_cached());
+    EXPECT_EQ(renderer.composites, 0);
+    EXPECT_EQ(renderer.screen_cells,
+              static_cast<std::size_t>(2 * grid.grid_size.row * grid.grid_size.column));
+}
@@ -0,0 +1,27 @@
+// test/fixed_step_driver_test.cpp
+#include <gtest/gtest.h>
+#include <core/FixedStepDriver.hpp>
+
+TEST(FixedStepDriverTest, StepCountDoesNotDependOnFrameRate) {
+    // 1 秒分を 30 / 60 / 144 Hz で刻んでも、ロジックのティック数は同じ
+    for (const double hz : {30.0, 60.0, 144.0}) {
+        FixedStepDriver driver;
+        for (int frame = 0; frame < static_cast<int>(hz); ++frame) driver.advance(1.0 / hz);
+        EXPECT_NEAR(static_cast<double>(driver.total_steps()), timestep::kTicksPerSecond, 1.0)
+            << hz << " Hz";
+    }
+}
+
+TEST(FixedStepDriverTest, AlphaIsRemainderOfStep) {
+    FixedStepDriver driver(0.01, 8);
+    const FrameSteps frame = driver.advance(0.025);
+    EXPECT_EQ(frame.steps, 2);
+    EXPECT_NEAR(frame.alpha, 0.5, 1e-9);
+}
+
+TEST(FixedStepDriverTest, CatchUpIsCappedAndBacklogDropped) {
+    FixedStepDriver driver(0.01, 4);
+    EXPECT_EQ(driver.advance(0.2).steps, 4);  // 20 ティック分遅れても 4 回だけ
+    EXPECT_EQ(driver.advance(0.0).steps, 0);  // 残りは持ち越さない
+    EXPECT_EQ(driver.advance(-1.0).steps, 0);
+}
@@ -0,0 +1,63 @@
+// test/frame_metrics_test.cpp
+#include <gtest/gtest.h>
+#include <core/FrameMetrics.hpp>
+#include <thread>
+#include <vector>
+
+TEST(FrameMetricsTest, BucketsCoverEveryValueWithBoundedError) {
+    for (std::uint64_t micros = 0; micros < 200000; micros += 7) {
+        const std::size_t bucket = LatencyHistogram::bucket_of(micros);
+        const std::uint64_t upper = LatencyHistogram::upper_bound_of(bucket);
+        ASSERT_GE(upper, micros);
+        ASSERT_LE(upper, micros + micros / 8 + 1);
+        if (bucket > 0) {
+            ASSERT_LT(LatencyHistogram::upper_bound_of(bucket - 1), micros);
+        }
+    }
+}
+
+TEST(FrameMetricsTest, PercentilesOfUniformSamples) {
+    LatencyHistogram histogram;
+    for (std::uint64_t micros = 1; micros <= 1000; ++micros) histogram.record(micros);
+
+    const PhaseSummary summary = histogram.summarize();
+    EXPECT_EQ(summary.count, 1000u);
+    EXPECT_DOUBLE_EQ(summary.mean_us, 500.5);
+    EXPECT_EQ(summary.max_us, 1000u);
+    EXPECT_GE(summary.p50_us, 500u);
+    EXPECT_LE(summary.p50_us, 500u + 500u / 8);
+    EXPECT_GE(summary.p99_us, 990u);
+    EXPECT_LE(summary.p99_us, 1000u);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.summarize().count, 0u);
+    EXPECT_EQ(histogram.summarize().max_us, 0u);
+}
+
+TEST(FrameMetricsTest, ConcurrentRecordsAreNotLost) {
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&histogram, t] {
+            const auto micros = static_cast<std::uint64_t>(t * 100 + 1);
+            for (int i = 0; i < 10000; ++i) histogram.record(micros);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    const PhaseSummary summary = histogram.summarize();
+    EXPECT_EQ(summary.count, 40000u);
+    EXPECT_EQ(summary.max_us, 301u);
+}
+
+TEST(FrameMetricsTest, PhaseTimerRecordsIntoItsPhase) {
+    FrameMetrics metrics;
+    {
+        PhaseTimer timer(metrics, FramePhase::RENDER);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    EXPECT_EQ(metrics.summary(FramePhase::RENDER).count, 1u);
+    EXPECT_GE(metrics.summary(FramePhase::RENDER).max_us, 2000u);
+    EXPECT_EQ(metrics.summary(FramePhase::UPDATE).count, 0u);
+    EXPECT_EQ(metrics.frames(), 0u);
+}
@@ -0,0 +1,39 @@
+// test/frame_pacer_test.cpp
+#include <gtest/gtest.h>
+#include <core/FramePacer.hpp>
+
+TEST(FramePacerTest, StatsTrackMeanAndJitter) {
+    FrameTimeStats stats;
+    for (double ms : {16.0, 17.0, 16.0, 17.0}) stats.add(ms);
+    EXPECT_EQ(stats.count, 4u);
+    EXPECT_DOUBLE_EQ(stats.mean_ms, 16.5);
+    EXPECT_DOUBLE_EQ(stats.min_ms, 16.0);
+    EXPECT_DOUBLE_EQ(stats.max_ms, 17.0);
+    EXPECT_NEAR(stats.variance_ms2(), 1.0 / 3.0, 1e-12);
+}
+
+TEST(FramePacerTest, WaitUntilNeverReturnsEarly) {
+    using frame_pacing::Clock;
+    for (int i = 0; i < 5; ++i) {
+        const Clock::time_point deadline = Clock::now() + std::chrono::microseconds(3000);
+        frame_pacing::wait_until(deadline);
+        EXPECT_GE(Clock::now(), deadline);
+    }
+}
+
+TEST(FramePacerTest, TargetFpsKeepsToItsDeadlines) {
+    using frame_pacing::Clock;
+    constexpr int kFrames = 5;
+    constexpr auto kPeriod = std::chrono::milliseconds(5);
+    FramePacer pacer(PacingMode::TARGET_FPS, 200.0);
+    pacer.wait_for_next_frame();
+    pacer.reset_stats();
+
+    const Clock::time_point start = Clock::now();
+    for (int i = 0; i < kFrames; ++i) pacer.wait_for_next_frame();
+    const Clock::duration elapsed = Clock::now() - start;
+    EXPECT_EQ(pacer.stats().count, static_cast<std::uint64_t>(kFrames));
+    // 締め切りは周期ずつ進む。寝過ごした次の間隔は周期より短くなり得るが、締め切りより前には
+    // 戻らないので、N フレームの合計は (N - 1) 周期を下回らない
+    EXPECT_GE(elapsed, kPeriod * (kFrames - 1));
+}
@@ -0,0 +1,219 @@
+// test/pipelined_renderer_test.cpp
+#include <gtest/gtest.h>
+#include <chrono>
+#include <core/TripleBuffer.hpp>
+#include <core/render/PipelinedRenderer.hpp>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test_support.hpp"
+
+namespace {
+// 描画スレッドで受け取った呼び出しを記録するレンダラ（所有は描画スレッド、記録は共有）
+struct PresentLog {
+    std::mutex mutex;
+    std::vector<Color> frame_colors;  ///< フレームごとの最後の fill_rect の色
+    std::vector<FontId> text_fonts;
+    std::vector<std::string> events;  ///< draw_text と release_font を呼ばれた順に
+    std::thread::id thread;
+    bool destroyed = false;
+    std::thread::id destroyed_on;
+};
+
+class LoggingRenderer final : public test_support::NullRenderer {
+   public:
+    LoggingRenderer(std::shared_ptr<PresentLog> log, std::chrono::milliseconds present_time)
+        : log_(std::move(log)), present_time_(present_time) {
+        std::lock_guard<std::mutex> lock(log_->mutex);
+        log_->thread = std::this_thread::get_id();
+    }
+    ~LoggingRenderer() override {
+        std::lock_guard<std::mutex> lock(log_->mutex);
+        log_->destroyed = true;
+        log_->destroyed_on = std::this_thread::get_id();
+    }
+
+    void end_frame() override {
+        std::this_thread::sleep_for(present_time_);  // 垂直同期待ちの代わり
+        std::lock_guard<std::mutex> lock(log_->mutex);
+        log_->frame_colors.push_back(last_color_);
+    }
+    void fill_rect(const Rect&, Color color) override { last_color_ = color; }
+    tl::expected<FontId, std::string> register_font(const std::string&, int) override {
+        return FontId{42};
+    }
+    tl::expected<void, std::string> draw_text(FontId font, const std::string&, Position,
+                                              Color) override {
+        std::lock_guard<std::mutex> lock(log_->mutex);
+        log_->text_fonts.push_back(font);
+        log_->events.push_back("draw_text " + std::to_string(font));
+        return {};
+    }
+    void release_font(FontId font) override {
+        std::lock_guard<std::mutex> lock(log_->mutex);
+        log_->events.push_back("release_font " + std::to_string(font));
+    }
+
+   private:
+    std::shared_ptr<PresentLog> log_;
+    std::chrono::milliseconds present_time_;
+    Color last_color_{};
+};
+
+std::unique_ptr<PipelinedRenderer> make_pipelined(
+    const std::shared_ptr<PresentLog>& log,
+    std::chrono::milliseconds present_time = std::chrono::milliseconds{0}) {
+    return PipelinedRenderer::create(
+               [log, present_time]() -> tl::expected<std::unique_ptr<IRenderer>, std::string> {
+                   return std::make_unique<LoggingRenderer>(log, present_time);
+               },
+               100, 100)
+        .value();
+}
+
+Color frame_color(int i) { return Color{static_cast<std::uint8_t>(i), 0, 0, 255}; }
+}  // namespace
+
+TEST(TripleBufferTest, ReaderSeesOnlyTheLatestPublishedValue) {
+    TripleBuffer<int> buffer(0);
+    EXPECT_FALSE(buffer.consume());
+
+    buffer.back() = 1;
+    EXPECT_FALSE(buffer.publish());
+    buffer.back() = 2;
+    EXPECT_TRUE(buffer.publish());  // 1 は読まれずに上書きされた
+    EXPECT_TRUE(buffer.has_update());
+
+    ASSERT_TRUE(buffer.consume());
+    EXPECT_EQ(buffer.front(), 2);
+    EXPECT_FALSE(buffer.consume());
+    EXPECT_EQ(buffer.front(), 2);
+}
+
+TEST(TripleBufferTest, ConcurrentReaderNeverGoesBackwards) {
+    TripleBuffer<std::vector<int>> buffer;
+    constexpr int kFrames = 20000;
+    std::thread writer([&] {
+        for (int i = 1; i <= kFrames; ++i) {
+            buffer.back().assign(16, i);  // 枠全体が同じ値なら途中の書き込みを見ていない
+            buffer.publish();
+        }
+    });
+    int last = 0;
+    while (last < kFrames) {
+        if (!buffer.consume()) continue;
+        const std::vector<int>& frame = buffer.front();
+        ASSERT_EQ(frame.size(), 16u);
+        for (const int value : frame) ASSERT_EQ(value, frame.front());
+        ASSERT_GT(frame.front(), last);
+        last = frame.front();
+    }
+    writer.join();
+}
+
+TEST(PipelinedRendererTest, RendererLivesOnTheRenderThread) {
+    auto log = std::make_shared<PresentLog>();
+    auto pipelined = make_pipelined(log);
+    pipelined.reset();
+
+    std::lock_guard<std::mutex> lock(log->mutex);
+    EXPECT_TRUE(log->destroyed);
+    EXPECT_NE(log->thread, std::this_thread::get_id());
+    EXPECT_EQ(log->destroyed_on, log->thread);
+}
+
+TEST(PipelinedRendererTest, FactoryErrorIsReturned) {
+    auto result = PipelinedRenderer::create(
+        []() -> tl::expected<std::unique_ptr<IRenderer>, std::string> {
+            return tl::unexpected<std::string>{"no window"};
+        },
+        100, 100);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), "no window");
+}
+
+TEST(PipelinedRendererTest, SlowPresentDoesNotStallTheProducer) {
+    auto log = std::make_shared<PresentLog>();
+    auto pipelined = make_pipelined(log, std::chrono::milliseconds{20});
+    constexpr int kFrames = 50;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 1; i <= kFrames; ++i) {
+        pipelined->begin_frame();
+        pipelined->fill_rect({{0, 0}, {10, 10}}, frame_color(i));
+        pipelined->end_frame();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    // 直列なら 50 × 20 ms = 1 s かかる
+    EXPECT_LT(elapsed, std::chrono::milliseconds{500});
+    EXPECT_EQ(pipelined->frames_published(), static_cast<std::uint64_t>(kFrames));
+    EXPECT_GT(pipelined->frames_dropped(), 0u);
+
+    pipelined.reset();
+    std::lock_guard<std::mutex> lock(log->mutex);
+    ASSERT_FALSE(log->frame_colors.empty());
+    EXPECT_LT(log->frame_colors.size(), static_cast<std::size_t>(kFrames));
+    // 最後に渡したフレームは必ず描かれ、描かれる順序は渡した順を保つ
+    EXPECT_EQ(log->frame_colors.back().r, kFrames);
+    for (std::size_t i = 1; i < log->frame_colors.size(); ++i) {
+        EXPECT_LT(log->frame_colors[i - 1].r, log->frame_colors[i].r);
+    }
+}
+
+TEST(PipelinedRendererTest, FontsAreCreatedOnTheRenderThread) {
+    auto log = std::make_shared<PresentLog>();
+    auto pipelined = make_pipelined(log);
+    const auto font = pipelined->register_font("font.ttf", 12);
+    ASSERT_TRUE(font);
+    EXPECT_EQ(*font, 42u);  // 描画スレッドのレンダラが払い出した ID がそのまま返る
+
+    pipelined->begin_frame();
+    ASSERT_TRUE(pipelined->draw_text(*font, "x", {0, 0}, colors::kWhite));
+    pipelined->end_frame();
+    EXPECT_FALSE(pipelined->set_vsync(true));  // ロジック側は垂直同期に頼らない
+
+    pipelined.reset();
+    std::lock_guard<std::mutex> lock(log->mutex);
+    EXPECT_EQ(log->text_fonts, std::vector<FontId>{42});
+}
+
+TEST(PipelinedRendererTest, ReleaseWaitsForFramesPublishedBeforeIt) {
+    auto log = std::make_shared<PresentLog>();
+    auto pipelined = make_pipelined(log, std::chrono::milliseconds{50});
+    const FontId font = pipelined->register_font("font.ttf", 12).value();
+
+    // 描画スレッドが 1 フレーム目の Present で待っている間に、フォントを使うフレームを渡して
+    // すぐに解放する。解放はそのフレームを描いた後でなければならない
+    pipelined->begin_frame();
+    pipelined->end_frame();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    pipelined->begin_frame();
+    ASSERT_TRUE(pipelined->draw_text(font, "x", {0, 0}, colors::kWhite));
+    pipelined->end_frame();
+    pipelined->release_font(font);
+
+    pipelined.reset();
+    std::lock_guard<std::mutex> lock(log->mutex);
+    const std::vector<std::string> expected{"draw_text 42", "release_font 42"};
+    EXPECT_EQ(log->events, expected);
+}
+
+TEST(PipelinedRendererTest, ReusedSlotsStartWithFreshStats) {
+    auto log = std::make_shared<PresentLog>();
+    auto pipelined = make_pipelined(log);
+
+    pipelined->begin_frame();
+    for (int i = 0; i < 3; ++i) pipelined->fill_rect({{0, 0}, {10, 10}}, frame_color(i));
+    pipelined->end_frame();
+    EXPECT_EQ(pipelined->last_frame_stats().draw_calls, 3u);
+
+    // 3 つの枠を一巡しても、前に同じ枠で記録したフレームの数は残らない
+    for (int frame = 0; frame < 6; ++frame) {
+        pipelined->begin_frame();
+        pipelined->fill_rect({{0, 0}, {10, 10}}, colors::kBlue);
+        pipelined->end_frame();
+        EXPECT_EQ(pipelined->last_frame_stats().draw_calls, 1u);
+        EXPECT_EQ(pipelined->last_frame_stats().pixels_covered, 100u);
+    }
+}
@@ -0,0 +1,155 @@
+// test/render_budget_test.cpp
+// シーン・盤面の描画呼び出し数の上限と、命令列のゴールデン比較
+//   - まとめ描きがセルごとの呼び出しに戻るなどの退行はここで落ちる
+//   - ゴールデンを更新するときは、dump() の差分が意図どおりかを確認してから書き換えること
+#include <gtest/gtest.h>
+#include <core/GameConfig.hpp>
+#include <core/ResourceManager.hpp>
+#include <core/TetrisGrid.hpp>
+#include <core/render/BoardRenderCache.hpp>
+#include <core/render/RecordingRenderer.hpp>
+#include <core/render/SoftwareRenderer.hpp>
+#include <core/scene/InitialScene.hpp>
+#include <core/scene/NextScene.hpp>
+#include "test_support.hpp"
+
+namespace {
+constexpr GameConfig kConfig = game_config::defaultGameConfig;
+
+// 描画呼び出しの予算（1 フレームあたり）
+constexpr std::size_t kGridDrawCallBudget = 2;         // fill_rects + stroke_rects
+constexpr std::size_t kCachedBoardDrawCallBudget = 1;  // 変化のないフレームは合成 1 回
+constexpr std::size_t kInitialSceneDrawCallBudget = 2;
+constexpr std::size_t kNextSceneDrawCallBudget = 1;
+
+RecordingRenderer make_recorder() {
+    return RecordingRenderer(kConfig.window.width, kConfig.window.height);
+}
+
+template <typename Draw>
+RenderStats record_frame(RecordingRenderer& recorder, Draw&& draw) {
+    recorder.begin_frame();
+    draw();
+    recorder.end_frame();
+    return recorder.frames().back();
+}
+}  // namespace
+
+using test_support::fill;
+using test_support::make_grid;
+
+TEST(RenderBudgetTest, GridIsTwoBatchedCalls) {
+    const TetrisGrid grid = fill(fill(make_grid(), {0, 19}), {9, 19});
+    RecordingRenderer recorder = make_recorder();
+    const RenderStats stats = record_frame(recorder, [&] { grid.render(recorder); });
+
+    const auto cells = static_cast<std::size_t>(grid.grid_size.row * grid.grid_size.column);
+    EXPECT_LE(stats.draw_calls, kGridDrawCallBudget);
+    EXPECT_EQ(stats.primitives, cells);
+    EXPECT_LE(stats.state_changes, 1u);  // 枠線の色だけ
+    // セル同士は重ならない
+    EXPECT_LE(stats.overdraw(), 1.0);
+
+    const std::string dump = recorder.dump();
+    EXPECT_NE(dump.find("fill_rects 2\n"), std::string::npos) << dump;
+    EXPECT_NE(dump.find("stroke_rects " + std::to_string(cells - 2) + " #000000ff\n"),
+              std::string::npos);
+}
+
+TEST(RenderBudgetTest, UnchangedCachedBoardOnlyComposites) {
+    const TetrisGrid grid = make_grid();
+    RecordingRenderer recorder = make_recorder();
+    BoardRenderCache cache;
+    record_frame(recorder, [&] { cache.render(recorder, grid); });
+    recorder.clear_commands();
+
+    const RenderStats stats = record_frame(recorder, [&] { cache.render(recorder, grid); });
+    EXPECT_LE(stats.draw_calls, kCachedBoardDrawCallBudget);
+    EXPECT_EQ(recorder.dump(),
+              "begin_frame\n"
+              "draw_texture 1 src 0,0 300x600 dst 0,0 300x600\n"
+              "end_frame\n");
+}
+
+TEST(RenderBudgetTest, NextSceneGolden) {
+    NextScene scene;
+    scene.initialize(kConfig);
+    RecordingRenderer recorder = make_recorder();
+    const RenderStats stats = record_frame(recorder, [&] { scene.render(recorder); });
+
+    EXPECT_LE(stats.draw_calls, kNextSceneDrawCallBudget);
+    EXPECT_EQ(recorder.dump(),
+              "begin_frame\n"
+              "fill_rect 0,0 100x200 #ff0000ff\n"
+              "end_frame\n");
+}
+
+TEST(RenderBudgetTest, InitialSceneGolden) {
+    RecordingRenderer recorder = make_recorder();
+    ResourceManager resources(recorder);
+    InitialScene scene;
+    scene.initialize(kConfig, resources);
+    recorder.clear_commands();  // フォントの先読みは描画フレームに含めない
+
+    const RenderStats stats = record_frame(recorder, [&] { scene.render(recorder); });
+    EXPECT_LE(stats.draw_calls, kInitialSceneDrawCallBudget);
+    EXPECT_EQ(recorder.dump(),
+              "begin_frame\n"
+              "fill_rect 100,100 100x200 #0000ffff\n"
+              "draw_text 0 100,100 #ffffffff \"Sample Scene\"\n"
+              "end_frame\n");
+
+    // 先読みしたフォントは cleanup で返す（最後の参照なので解放される）
+    scene.cleanup();
+    EXPECT_EQ(resources.font_count(), 0u);
+}
+
+TEST(RenderBudgetTest, StatsCountStateChangesAndOverdraw) {
+    RecordingRenderer recorder(10, 10);
+    const RenderStats stats = record_frame(recorder, [&] {
+        recorder.clear(colors::kBlack);
+        recorder.fill_rect({{0, 0}, {10, 5}}, colors::kRed);
+        recorder.fill_rect({{0, 5}, {10, 5}}, colors::kRed);   // 同じ色は切り替えに数えない
+        recorder.fill_rect({{-5, -5}, {10, 10}}, colors::kBlue);  // 画面内の 5×5 だけ数える
+        recorder.fill_rects(nullptr, 0);                           // 空のまとめ描きは数えない
+    });
+    EXPECT_EQ(stats.draw_calls, 3u);
+    EXPECT_EQ(stats.state_changes, 2u);
+    EXPECT_EQ(stats.pixels_covered, 100u + 50u + 50u + 25u);
+    EXPECT_DOUBLE_EQ(stats.overdraw(), 2.25);
+}
+
+TEST(RenderBudgetTest, ReplayReproducesThePixels) {
+    const TetrisGrid grid = fill(make_grid(), {4, 10});
+    RecordingRenderer recorder = make_recorder();
+    BoardRenderCache cache;
+    record_frame(recorder, [&] {
+        recorder.clear(BoardRenderCache::kBackground);
+        cache.render(recorder, grid);
+        recorder.draw_line({0, 0}, {299, 599}, colors::kWhite);
+    });
+
+    auto direct = SoftwareRenderer::create(kConfig.window.width, kConfig.window.height).value();
+    direct->clear(BoardRenderCache::kBackground);
+    grid.render(*direct);
+    direct->draw_line({0, 0}, {299, 599}, colors::kWhite);
+
+    auto replayed = SoftwareRenderer::create(kConfig.window.width, kConfig.window.height).value();
+    ASSERT_TRUE(recorder.replay(*replayed));
+    EXPECT_EQ(replayed->frame_count(), 1u);
+    EXPECT_EQ(replayed->framebuffer().pixels, direct->framebuffer().pixels);
+}
+
+TEST(RenderBudgetTest, ReplayRegistersFontsOnTheTarget) {
+    RecordingRenderer recorder = make_recorder();
+    const FontId font = recorder.register_font("font.ttf", 12).value();
+    ASSERT_TRUE(recorder.draw_text(font, "x", {0, 0}, colors::kWhite));
+
+    RecordingRenderer target = make_recorder();
+    ASSERT_TRUE(target.register_font("other.ttf", 8));  // 再生先の ID がずれていても対応付ける
+    ASSERT_TRUE(recorder.replay(target));
+    EXPECT_EQ(target.dump(),
+              "register_font 0 \"other.ttf\" 8\n"
+              "register_font 1 \"font.ttf\" 12\n"
+              "draw_text 1 0,0 #ffffffff \"x\"\n");
+}
@@ -0,0 +1,138 @@
+// test/resource_manager_test.cpp
+#include <gtest/gtest.h>
+#include <core/ResourceManager.hpp>
+#include <core/scene/SceneManager.hpp>
+#include <memory>
+#include <vector>
+#include "test_support.hpp"
+
+namespace {
+// 読み込み・解放の回数だけを記録するレンダラ
+class LoadCountingRenderer final : public test_support::NullRenderer {
+   public:
+    int font_loads = 0;
+    int texture_loads = 0;
+    std::vector<FontId> released_fonts;
+    std::vector<TextureId> released_textures;
+
+    tl::expected<FontId, std::string> register_font(const std::string& path, int) override {
+        if (path == "missing.ttf") return tl::unexpected<std::string>{"not found"};
+        return static_cast<FontId>(font_loads++);
+    }
+    void release_font(FontId id) override { released_fonts.push_back(id); }
+    tl::expected<TextureId, std::string> load_texture(const std::string&) override {
+        return static_cast<TextureId>(100 + texture_loads++);
+    }
+    void release_texture(TextureId id) override { released_textures.push_back(id); }
+};
+
+// 同じフォントを使い、最初の update で同じ種類のシーンへ遷移するシーン
+class FontScene final : public IScene {
+   public:
+    explicit FontScene(bool hand_over) noexcept : hand_over_(hand_over) {}
+
+    void initialize(const GameConfig&) override {}
+    void initialize(const GameConfig&, ResourceManager& resources) override {
+        resources_ = &resources;
+        font_ = resources.acquire_font("font.ttf", 24).value();
+    }
+    void update(const double) override {
+        if (hand_over_) pending_scene_ = std::make_unique<FontScene>(false);
+        hand_over_ = false;
+    }
+    void process_input(const Input&) override {}
+    void render(IRenderer&) override {}
+    void cleanup() override { resources_->release_font(font_); }
+    std::optional<std::unique_ptr<IScene>> take_scene_transition() override {
+        if (pending_scene_) return std::move(pending_scene_);
+        return std::nullopt;
+    }
+
+   private:
+    bool hand_over_;
+    ResourceManager* resources_ = nullptr;
+    FontId font_ = 0;
+};
+}  // namespace
+
+TEST(ResourceManagerTest, SameFontKeyLoadsOnce) {
+    LoadCountingRenderer renderer;
+    ResourceManager resources(renderer);
+
+    // 毎フレーム取得しても読み込みは 1 回
+    FontId first = 0;
+    for (int frame = 0; frame < 60; ++frame) {
+        const auto font = resources.acquire_font("font.ttf", 24);
+        ASSERT_TRUE(font);
+        if (frame == 0) first = *font;
+        EXPECT_EQ(*font, first);
+    }
+    EXPECT_EQ(renderer.font_loads, 1);
+    EXPECT_EQ(resources.font_count(), 1u);
+    EXPECT_EQ(resources.font_references(first), 60);
+
+    // サイズ違いは別のフォント
+    const auto larger = resources.acquire_font("font.ttf", 32);
+    ASSERT_TRUE(larger);
+    EXPECT_NE(*larger, first);
+    EXPECT_EQ(renderer.font_loads, 2);
+}
+
+TEST(ResourceManagerTest, LastReleaseUnloadsFont) {
+    LoadCountingRenderer renderer;
+    ResourceManager resources(renderer);
+    const FontId font = resources.acquire_font("font.ttf", 24).value();
+    ASSERT_TRUE(resources.acquire_font("font.ttf", 24));
+
+    resources.release_font(font);
+    EXPECT_TRUE(renderer.released_fonts.empty());
+    resources.release_font(font);
+    EXPECT_EQ(renderer.released_fonts, std::vector<FontId>{font});
+    EXPECT_EQ(resources.font_count(), 0u);
+
+    // 解放後の release と未知の ID は無視する
+    resources.release_font(font);
+    resources.release_font(12345);
+    EXPECT_EQ(renderer.released_fonts.size(), 1u);
+
+    // 再取得すると読み込み直す
+    ASSERT_TRUE(resources.acquire_font("font.ttf", 24));
+    EXPECT_EQ(renderer.font_loads, 2);
+}
+
+TEST(ResourceManagerTest, FailedLoadIsNotCounted) {
+    LoadCountingRenderer renderer;
+    ResourceManager resources(renderer);
+    EXPECT_FALSE(resources.acquire_font("missing.ttf", 24));
+    EXPECT_EQ(resources.font_count(), 0u);
+    EXPECT_EQ(resources.load_count(), 0u);
+}
+
+TEST(ResourceManagerTest, TexturesAreDeduplicatedByPath) {
+    LoadCountingRenderer renderer;
+    ResourceManager resources(renderer);
+    const TextureId a = resources.acquire_texture("tiles.bmp").value();
+    const TextureId b = resources.acquire_texture("tiles.bmp").value();
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(renderer.texture_loads, 1);
+
+    resources.release_texture(a);
+    resources.release_texture(b);
+    EXPECT_EQ(renderer.released_textures, std::vector<TextureId>{a});
+    EXPECT_EQ(resources.texture_count(), 0u);
+}
+
+TEST(ResourceManagerTest, SceneTransitionKeepsSharedFontLoaded) {
+    LoadCountingRenderer renderer;
+    auto resources = std::make_shared<ResourceManager>(renderer);
+    SceneManager manager(std::make_unique<FontScene>(true),
+                         std::make_shared<const GameConfig>(game_config::defaultGameConfig),
+                         resources);
+    ASSERT_EQ(renderer.font_loads, 1);
+
+    // 次のシーンが取得してから前のシーンが返すので、解放も再読み込みも起きない
+    manager.update(1.0 / 60.0);
+    EXPECT_EQ(renderer.font_loads, 1);
+    EXPECT_TRUE(renderer.released_fonts.empty());
+    EXPECT_EQ(resources->font_references(0), 1);
+}
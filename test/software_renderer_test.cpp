@@ -0,0 +1,181 @@
+// test/software_renderer_test.cpp
+#include <gtest/gtest.h>
+#include <core/GameConfig.hpp>
+#include <core/render/BoardRenderCache.hpp>
+#include <core/render/PixelOps.hpp>
+#include <core/render/SoftwareRenderer.hpp>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <vector>
+#include "test_support.hpp"
+
+namespace {
+std::unique_ptr<SoftwareRenderer> make_renderer(int width = 16, int height = 16) {
+    return SoftwareRenderer::create(width, height).value();
+}
+
+Rect rect(double x, double y, double w, double h) { return Rect{{x, y}, {w, h}}; }
+
+std::size_t count_pixels(const Framebuffer& fb, Color color) {
+    const std::uint32_t packed = pixel_ops::pack(color);
+    std::size_t n = 0;
+    for (const std::uint32_t p : fb.pixels) n += p == packed ? 1 : 0;
+    return n;
+}
+}  // namespace
+
+TEST(PixelOpsTest, SimdSpanMatchesScalarReference) {
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<std::uint32_t> byte(0, 255);
+    // SIMD の幅（4 / 8）で割り切れない長さも混ぜる
+    for (const std::size_t length : {1u, 3u, 4u, 7u, 8u, 9u, 31u, 64u, 101u}) {
+        for (int trial = 0; trial < 20; ++trial) {
+            std::vector<std::uint32_t> pixels(length);
+            for (auto& p : pixels) {
+                p = byte(rng) | byte(rng) << 8 | byte(rng) << 16 | byte(rng) << 24;
+            }
+            std::vector<std::uint32_t> expected = pixels;
+            const Color color{static_cast<std::uint8_t>(byte(rng)),
+                              static_cast<std::uint8_t>(byte(rng)),
+                              static_cast<std::uint8_t>(byte(rng)),
+                              static_cast<std::uint8_t>(1 + byte(rng) % 254)};
+
+            pixel_ops::blend_span(pixels.data(), pixels.size(), color);
+            pixel_ops::blend_span_scalar(expected.data(), expected.size(), color);
+            ASSERT_EQ(pixels, expected) << "backend " << pixel_ops::simd_backend() << ", length "
+                                        << length;
+        }
+    }
+}
+
+TEST(PixelOpsTest, BlendMatchesExactDivisionRounded) {
+    for (std::uint32_t a = 0; a <= 255; a += 5) {
+        for (std::uint32_t d = 0; d <= 255; d += 3) {
+            const std::uint32_t out = pixel_ops::blend_pixel(
+                d, Color{200, 0, 0, static_cast<std::uint8_t>(a)});
+            const double exact = (200.0 * a + d * (255.0 - a)) / 255.0;
+            EXPECT_EQ(out & 0xFF, static_cast<std::uint32_t>(exact + 0.5)) << a << " " << d;
+        }
+    }
+}
+
+TEST(SoftwareRendererTest, RejectsInvalidSize) {
+    EXPECT_FALSE(SoftwareRenderer::create(0, 10));
+    EXPECT_FALSE(SoftwareRenderer::create(10, -1));
+}
+
+TEST(SoftwareRendererTest, FillRectIsClippedToTheFramebuffer) {
+    auto renderer = make_renderer(8, 8);
+    renderer->clear(colors::kBlack);
+    renderer->fill_rect(rect(-2, 6, 4, 10), colors::kRed);
+
+    const Framebuffer& fb = renderer->framebuffer();
+    EXPECT_EQ(count_pixels(fb, colors::kRed), 4u);  // x: 0..1, y: 6..7
+    EXPECT_EQ(fb.at(1, 7), pixel_ops::pack(colors::kRed));
+    EXPECT_EQ(fb.at(2, 7), pixel_ops::pack(colors::kBlack));
+}
+
+TEST(SoftwareRendererTest, TranslucentFillBlendsOverTheBackground) {
+    auto renderer = make_renderer(4, 4);
+    renderer->clear(colors::kBlack);
+    renderer->fill_rect(rect(0, 0, 4, 4), Color{255, 255, 255, 128});
+    EXPECT_EQ(renderer->framebuffer().at(3, 3), pixel_ops::pack(Color{128, 128, 128, 255}));
+}
+
+TEST(SoftwareRendererTest, StrokeRectBlendsCornersOnce) {
+    auto renderer = make_renderer(8, 8);
+    renderer->clear(colors::kBlack);
+    const Color half{255, 255, 255, 128};
+    renderer->stroke_rect(rect(1, 1, 4, 3), half);
+
+    const Framebuffer& fb = renderer->framebuffer();
+    const std::uint32_t once = pixel_ops::pack(Color{128, 128, 128, 255});
+    EXPECT_EQ(count_pixels(fb, Color{128, 128, 128, 255}), 10u);  // 周囲 4×3 − 内側 2×1
+    EXPECT_EQ(fb.at(1, 1), once);
+    EXPECT_EQ(fb.at(4, 3), once);
+    EXPECT_EQ(fb.at(2, 2), pixel_ops::pack(colors::kBlack));
+}
+
+TEST(SoftwareRendererTest, DrawLineIncludesBothEndpoints) {
+    auto renderer = make_renderer(8, 8);
+    renderer->clear(colors::kBlack);
+    renderer->draw_line({0, 0}, {7, 7}, colors::kGreen);
+    renderer->draw_line({6, 1}, {2, 1}, colors::kBlue);
+
+    const Framebuffer& fb = renderer->framebuffer();
+    EXPECT_EQ(count_pixels(fb, colors::kGreen), 8u);
+    EXPECT_EQ(fb.at(7, 7), pixel_ops::pack(colors::kGreen));
+    EXPECT_EQ(count_pixels(fb, colors::kBlue), 5u);
+}
+
+TEST(SoftwareRendererTest, DrawLineClipsHugeAndOffscreenCoordinates) {
+    auto renderer = make_renderer(8, 8);
+    renderer->clear(colors::kBlack);
+    // int に収まらない座標でも画面内の部分だけを描く
+    renderer->draw_line({-1e12, 4}, {1e12, 4}, colors::kBlue);
+    renderer->draw_line({-1e10, -1e10}, {1e10, 1e10}, colors::kGreen);
+    // 画面にかからない線と、有限でない座標は何も描かない
+    renderer->draw_line({-50, -1}, {50, -1}, colors::kRed);
+    renderer->draw_line({20, 0}, {30, 7}, colors::kRed);
+    renderer->draw_line({0, 0}, {std::numeric_limits<double>::quiet_NaN(), 3}, colors::kRed);
+
+    const Framebuffer& fb = renderer->framebuffer();
+    EXPECT_EQ(count_pixels(fb, colors::kGreen), 8u);
+    EXPECT_EQ(fb.at(0, 0), pixel_ops::pack(colors::kGreen));
+    EXPECT_EQ(fb.at(7, 7), pixel_ops::pack(colors::kGreen));
+    EXPECT_EQ(count_pixels(fb, colors::kBlue), 7u);  // (4, 4) は対角線が上書きした
+    EXPECT_EQ(count_pixels(fb, colors::kRed), 0u);
+}
+
+TEST(SoftwareRendererTest, RenderTargetCompositesLikeDirectDrawing) {
+    const TetrisGrid grid = test_support::make_grid("software");
+    const int width = 640;
+    const int height = 720;
+
+    auto direct = make_renderer(width, height);
+    direct->clear(BoardRenderCache::kBackground);
+    grid.render(*direct);
+
+    auto cached = make_renderer(width, height);
+    BoardRenderCache cache;
+    cached->clear(BoardRenderCache::kBackground);
+    cache.render(*cached, grid);
+
+    EXPECT_TRUE(cache.is_cached());
+    EXPECT_EQ(cached->framebuffer().pixels, direct->framebuffer().pixels);
+}
+
+TEST(SoftwareRendererTest, FontsAreNotSupported) {
+    auto renderer = make_renderer();
+    EXPECT_FALSE(renderer->register_font("font.ttf", 12));
+    EXPECT_FALSE(renderer->draw_text(0, "x", {0, 0}, colors::kWhite));
+}
+
+TEST(SoftwareRendererTest, WritesPngAndRawDumps) {
+    auto renderer = make_renderer(3, 2);
+    renderer->clear(colors::kCyan);
+    renderer->end_frame();
+    EXPECT_EQ(renderer->frame_count(), 1u);
+
+    const std::vector<std::uint8_t> png = encode_png(renderer->framebuffer());
+    const std::vector<std::uint8_t> signature{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    ASSERT_GT(png.size(), signature.size());
+    EXPECT_TRUE(std::equal(signature.begin(), signature.end(), png.begin()));
+    // IHDR の幅・高さ（ビッグエンディアン）
+    EXPECT_EQ(png[19], 3);
+    EXPECT_EQ(png[23], 2);
+
+    const std::string path = ::testing::TempDir() + "software_renderer_test.raw";
+    ASSERT_TRUE(renderer->write_raw(path));
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<char> raw{std::istreambuf_iterator<char>(file),
+                                std::istreambuf_iterator<char>()};
+    ASSERT_EQ(raw.size(), 3u * 2u * 4u);
+    EXPECT_EQ(static_cast<std::uint8_t>(raw[0]), 0);    // R
+    EXPECT_EQ(static_cast<std::uint8_t>(raw[1]), 255);  // G
+    EXPECT_EQ(static_cast<std::uint8_t>(raw[3]), 255);  // A
+    file.close();
+    std::remove(path.c_str());
+}
@@ -0,0 +1,55 @@
+// test/state_pool_test.cpp
+#include <gtest/gtest.h>
+#include <core/GameConfig.hpp>
+#include <core/StatePool.hpp>
+#include <core/scene/InitialScene.hpp>
+#include <core/scene/NextScene.hpp>
+#include <core/scene/SampleSceneGameState.hpp>
+
+namespace {
+Input holding(InputKey key, bool first_frame) {
+    Input input;
+    if (first_frame) input.key_down(key);
+    input.held |= Input::bit_of(key);
+    return input;
+}
+}  // namespace
+
+TEST(StatePoolTest, ReturnedBlocksAreReused) {
+    StatePool pool;
+    void* first = pool.allocate(40);
+    pool.deallocate(first, 40);
+    void* second = pool.allocate(48);  // 同じ 16 バイト刻みの区分
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(pool.heap_allocations(), 1u);
+    EXPECT_EQ(pool.reused(), 1u);
+    pool.deallocate(second, 48);
+
+    // 区分を超える大きさはプールを通らない
+    void* large = pool.allocate(4096);
+    pool.deallocate(large, 4096);
+    EXPECT_EQ(pool.heap_allocations(), 1u);
+}
+
+TEST(StatePoolTest, PooledStatesOutliveTheirScene) {
+    std::shared_ptr<const IGameState> survivor;
+    {
+        auto pool = std::make_shared<StatePool>();
+        survivor = make_pooled<SampleSceneGameState>(pool, Position{1, 2}, std::nullopt, pool);
+    }
+    // プールは状態が持つアロケータが生かしている
+    ASSERT_NE(survivor, nullptr);
+    EXPECT_FALSE(survivor->is_ready_to_transition());
+    survivor.reset();
+}
+
+TEST(StatePoolTest, UnchangedStepReturnsTheSameState) {
+    auto pool = std::make_shared<StatePool>();
+    const std::shared_ptr<const IGameState> state =
+        make_pooled<SampleSceneGameState>(pool, Position{100, 100}, std::nullopt, pool);
+    EXPECT_EQ(state->step(Input{}, 1.0 / 60.0), state);
+    EXPECT_NE(state->step(holding(InputKey::DOWN, true), 1.0 / 60.0), state);
+
+    const auto next = std::make_shared<NextSceneGameState>();
+    EXPECT_EQ(next->step(Input{}, 1.0 / 60.0), next);
+}
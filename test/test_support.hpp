@@ -0,0 +1,60 @@
+// test/test_support.hpp
+// 複数のテストで使う盤面の組み立てと、何もしないレンダラ
+#ifndef C9F99551_8950_427B_81C2_6E6F2D9E084C
+#define C9F99551_8950_427B_81C2_6E6F2D9E084C
+
+#include <core/GameConfig.hpp>
+#include <core/IRenderer.hpp>
+#include <core/TetrisGrid.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace test_support {
+
+/// 既定の設定の空の盤面
+inline TetrisGrid make_grid(std::string id = "test") {
+    return TetrisGrid::create(std::move(id), game_config::defaultGameConfig).value();
+}
+
+/// EMPTY → MOVING → FILLED の正規の遷移で 1 セルを埋める（色は Z）
+inline TetrisGrid fill(const TetrisGrid& grid, GridColumnRow cell) {
+    const Color red = tetrimino::color_of(TetriminoType::Z);
+    return grid.update_cell(cell, CellStatus::MOVING, red)
+        ->update_cell(cell, CellStatus::FILLED, red)
+        .value();
+}
+
+/// 複数のセルを順に埋める（TetrisGrid は再代入できないので再帰で畳み込む）
+inline TetrisGrid fill_cells(const TetrisGrid& grid, const std::vector<GridColumnRow>& cells,
+                             std::size_t index = 0) {
+    if (index == cells.size()) return grid;
+    return fill_cells(fill(grid, cells[index]), cells, index + 1);
+}
+
+/**
+ * 何もしないレンダラ。テストの偽物は、これを継承して確かめたい呼び出しだけを上書きする
+ *   - 命令列や描画統計を確かめるなら RecordingRenderer を使う
+ *   - フォントの登録は失敗を返す
+ */
+class NullRenderer : public IRenderer {
+   public:
+    void begin_frame() override {}
+    void end_frame() override {}
+    void clear(Color) override {}
+    void fill_rect(const Rect&, Color) override {}
+    void stroke_rect(const Rect&, Color) override {}
+    void draw_line(Position, Position, Color) override {}
+    void draw_texture(TextureId, const Rect&, const Rect&, double) override {}
+    tl::expected<FontId, std::string> register_font(const std::string&, int) override {
+        return tl::unexpected<std::string>{"unsupported"};
+    }
+    tl::expected<void, std::string> draw_text(FontId, const std::string&, Position,
+                                              Color) override {
+        return {};
+    }
+};
+
+}  // namespace test_support
+
+#endif /* C9F99551_8950_427B_81C2_6E6F2D9E084C */
@@ -0,0 +1,45 @@
+// test/tetrimino_queue_test.cpp
+#include <gtest/gtest.h>
+#include <core/Random.hpp>
+#include <core/TetrisRule.hpp>
+#include <array>
+#include <vector>
+
+TEST(TetriminoTypeQueueTest, EveryBagContainsAllSevenTypes) {
+    TetriminoTypeQueue queue(12345);
+    for (int bag = 0; bag < 50; ++bag) {
+        std::array<int, 7> counts{};
+        for (int i = 0; i < 7; ++i) ++counts[static_cast<std::size_t>(queue.getNext())];
+        for (int count : counts) EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(TetriminoTypeQueueTest, PeekMatchesUpcomingPieces) {
+    TetriminoTypeQueue queue(7);
+    for (int round = 0; round < 20; ++round) {
+        std::vector<TetriminoType> preview;
+        for (std::size_t i = 0; i < TetriminoTypeQueue::kMaxPeek; ++i) {
+            preview.push_back(queue.peek(i));
+        }
+        TetriminoTypeQueue copy = queue;
+        for (TetriminoType expected : preview) EXPECT_EQ(copy.getNext(), expected);
+        queue.getNext();
+    }
+}
+
+TEST(TetriminoTypeQueueTest, SequenceIsPinnedForSeed) {
+    // ネイティブと WASM で同じ列になることを固定値で確認する
+    TetriminoTypeQueue a(42);
+    TetriminoTypeQueue b(42);
+    std::vector<int> sequence;
+    for (int i = 0; i < 14; ++i) {
+        const TetriminoType next = a.getNext();
+        EXPECT_EQ(next, b.getNext());
+        sequence.push_back(static_cast<int>(next));
+    }
+    const std::vector<int> golden{1, 4, 3, 6, 0, 2, 5, 3, 2, 0, 4, 1, 6, 5};
+    EXPECT_EQ(sequence, golden);
+
+    rng::Xoshiro128StarStar engine(42);
+    for (int i = 0; i < 1000; ++i) EXPECT_LT(engine.next_below(7), 7u);
+}
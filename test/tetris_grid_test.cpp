@@ -0,0 +1,246 @@
+// test/tetris_grid_test.cpp
+#include <gtest/gtest.h>
+#include <core/GameConfig.hpp>
+#include <core/TetrisGrid.hpp>
+#include <core/render/RecordingRenderer.hpp>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "test_support.hpp"
+
+using test_support::fill_cells;
+using test_support::make_grid;
+
+TEST(TetrisGridTest, CreateRejectsOversizedGrid) {
+    GameConfig config = game_config::defaultGameConfig;
+    config.grid.columns = grid_bitboard::kMaxColumns + 1;
+    EXPECT_FALSE(TetrisGrid::create("too-wide", config).has_value());
+    config.grid.columns = grid_bitboard::kMaxColumns;
+    config.grid.rows = grid_bitboard::kMaxRows + 1;
+    EXPECT_FALSE(TetrisGrid::create("too-tall", config).has_value());
+
+    // 検査を通らない生成経路はない（セル列から直接組み立てるコンストラクタは公開しない）
+    static_assert(!std::is_constructible_v<TetrisGrid, std::string, Position, Size, GridColumnRow,
+                                           CellFactory, TetrisGrid::CellRows>);
+}
+
+TEST(TetrisGridTest, OutOfBoundsIsColliding) {
+    const TetrisGrid grid = make_grid();
+    EXPECT_FALSE(grid.is_colliding({0, 0}, {9, 19}));
+    EXPECT_TRUE(grid.is_colliding({0, 0}, {-1, 0}));
+    EXPECT_TRUE(grid.is_colliding({9, 0}, {10, 0}));
+    EXPECT_TRUE(grid.is_colliding({0, 19}, {0, 20}));
+    EXPECT_TRUE(grid.is_colliding({0, 0}, {0, -1}));
+    EXPECT_FALSE(grid.is_filled_cell({-1, 0}));
+}
+
+TEST(TetrisGridTest, OccupancyFollowsCellUpdates) {
+    const TetrisGrid grid = make_grid();
+    const Color red = tetrimino::color_of(TetriminoType::Z);
+
+    const TetrisGrid moving = grid.update_cell({3, 5}, CellStatus::MOVING, red).value();
+    EXPECT_FALSE(moving.is_filled_cell({3, 5}));
+    EXPECT_TRUE(moving.is_colliding({3, 4}, {3, 5}));
+
+    const TetrisGrid filled = moving.update_cell({3, 5}, CellStatus::FILLED, red).value();
+    EXPECT_TRUE(filled.is_filled_cell({3, 5}));
+    EXPECT_EQ(filled.cell_at({3, 5}).type, CellStatus::FILLED);
+
+    // 不正遷移（EMPTY → FILLED）はエラー。元の盤面もビットボードも変わらない
+    EXPECT_FALSE(grid.update_cell({4, 5}, CellStatus::FILLED, red));
+    EXPECT_FALSE(grid.is_filled_cell({4, 5}));
+    EXPECT_FALSE(grid.is_colliding({4, 4}, {4, 5}));
+
+    const TetrisGrid cleared = filled.update_cell({3, 5}, CellStatus::EMPTY, red).value();
+    EXPECT_FALSE(cleared.is_filled_cell({3, 5}));
+    EXPECT_FALSE(cleared.is_colliding({3, 4}, {3, 5}));
+}
+
+TEST(TetrisGridTest, CanPlaceChecksWholePieceAgainstWallsAndFloor) {
+    const TetrisGrid grid = make_grid();
+    // I の R0 は 4x4 枠の 2 行目を使う
+    EXPECT_TRUE(grid.can_place(tetrimino::make({0, 0}, TetriminoType::I)));
+    EXPECT_TRUE(grid.can_place(tetrimino::make({6, 18}, TetriminoType::I)));
+    EXPECT_FALSE(grid.can_place(tetrimino::make({7, 18}, TetriminoType::I)));
+    EXPECT_FALSE(grid.can_place(tetrimino::make({-1, 0}, TetriminoType::I)));
+    EXPECT_FALSE(grid.can_place(tetrimino::make({0, 19}, TetriminoType::I)));
+}
+
+TEST(TetrisGridTest, ProbeMovesMatchesIndividualPlacements) {
+    const TetrisGrid grid = fill_cells(make_grid(), {{4, 3}});
+
+    // O を (2, 2) に置くとセルは (2..3, 2..3)。右隣の列 4 の行 3 が埋まっている。
+    const Tetrimino o = tetrimino::make({2, 2}, TetriminoType::O);
+    const MoveAvailability moves = grid.probe_moves(o);
+    EXPECT_TRUE(moves.left);
+    EXPECT_FALSE(moves.right);
+    EXPECT_TRUE(moves.down);
+    EXPECT_EQ(moves.left, grid.can_place(tetrimino::move(o, -1, 0)));
+    EXPECT_EQ(moves.right, grid.can_place(tetrimino::move(o, 1, 0)));
+    EXPECT_EQ(moves.down, grid.can_place(tetrimino::drop(o)));
+    EXPECT_EQ(moves.rotate_cw, grid.can_place(tetrimino::rotate_cw(o)));
+}
+
+TEST(TetrisGridTest, TryRotateKicksOffTheWall) {
+    const TetrisGrid grid = make_grid();
+    // 縦向き I（R90 は枠の 3 列目）を左壁にぴったり付ける
+    const Tetrimino vertical = tetrimino::rotate_cw(tetrimino::make({-2, 5}, TetriminoType::I));
+    ASSERT_TRUE(grid.can_place(vertical));
+
+    // その場で R180 に戻すと左にはみ出すので、キックで右へずれる
+    EXPECT_FALSE(grid.can_place(tetrimino::rotate_cw(vertical)));
+    const auto rotated = grid.try_rotate(vertical, tetrimino::RotationDirection::CW);
+    ASSERT_TRUE(rotated.has_value());
+    EXPECT_EQ(rotated->rot, Rotation::R180);
+    EXPECT_TRUE(grid.can_place(*rotated));
+    EXPECT_GT(rotated->pos.x, vertical.pos.x);
+}
+
+TEST(TetrisGridTest, ClearFullRowsCompactsRowsAbove) {
+    std::vector<GridColumnRow> cells{{0, 18}, {5, 16}};
+    for (int column = 0; column < 10; ++column) {
+        cells.push_back({column, 19});
+        cells.push_back({column, 17});
+    }
+    const TetrisGrid filled = fill_cells(make_grid(), cells);
+
+    const RowClearResult result = filled.clear_full_rows();
+    EXPECT_EQ(result.cleared_rows, 2);
+    EXPECT_TRUE(result.grid.is_filled_cell({0, 19}));   // 行 18 → 19
+    EXPECT_FALSE(result.grid.is_filled_cell({1, 19}));
+    EXPECT_TRUE(result.grid.is_filled_cell({5, 18}));   // 行 16 → 18
+    EXPECT_FALSE(result.grid.is_filled_cell({5, 16}));
+    EXPECT_EQ(result.grid.cell_at({0, 19}).type, CellStatus::FILLED);
+    EXPECT_EQ(result.grid.cell_at({0, 0}).type, CellStatus::EMPTY);
+    EXPECT_EQ(result.grid.cells.size(), 20u);
+
+    const RowClearResult none = result.grid.clear_full_rows();
+    EXPECT_EQ(none.cleared_rows, 0);
+}
+
+TEST(TetrisGridTest, UpdateCellsAppliesBatchAtomically) {
+    const TetrisGrid grid = make_grid();
+    const Color cyan = tetrimino::color_of(TetriminoType::I);
+
+    // 固定は EMPTY → MOVING → FILLED の 2 段階なので 8 要求を 1 バッチで流す
+    std::vector<CellUpdate> lock;
+    for (auto status : {CellStatus::MOVING, CellStatus::FILLED}) {
+        for (int column = 3; column < 7; ++column) lock.push_back({{column, 19}, status, cyan});
+    }
+
+    const auto locked = grid.update_cells(lock);
+    ASSERT_TRUE(locked.has_value());
+    for (int column = 3; column < 7; ++column) EXPECT_TRUE(locked->is_filled_cell({column, 19}));
+
+    // 最後の要求だけ不正遷移（FILLED → MOVING）。先頭の有効な要求も含めて何も適用されない
+    const auto rejected = locked->update_cells({CellUpdate{{0, 0}, CellStatus::MOVING, cyan},
+                                                CellUpdate{{3, 19}, CellStatus::MOVING, cyan}});
+    EXPECT_FALSE(rejected.has_value());
+    EXPECT_FALSE(grid.update_cells({CellUpdate{{10, 0}, CellStatus::MOVING, cyan}}).has_value());
+}
+
+TEST(TetrisGridTest, CellsArePackedAndExpandedOnDemand) {
+    const Color orange = tetrimino::color_of(TetriminoType::L);
+    const TetrisGrid grid = make_grid().update_cell({2, 4}, CellStatus::MOVING, orange).value();
+
+    const Cell cell = grid.cell_at({2, 4});
+    EXPECT_EQ(cell.type, CellStatus::MOVING);
+    EXPECT_EQ(cell.color.r, orange.r);
+    EXPECT_EQ(cell.color.g, orange.g);
+    EXPECT_EQ(cell.color.b, orange.b);
+    const Position expected = grid.get_position_of_cell({2, 4}, grid.cell_factory.size.width);
+    EXPECT_DOUBLE_EQ(cell.position.x, expected.x);
+    EXPECT_DOUBLE_EQ(cell.position.y, expected.y);
+    EXPECT_DOUBLE_EQ(cell.size.width, grid.cell_factory.size.width);
+
+    // パレットにない色は保存できない
+    const Color unknown{1, 2, 3, 255};
+    EXPECT_FALSE(grid.update_cells({CellUpdate{{0, 0}, CellStatus::MOVING, unknown}}).has_value());
+    const auto rejected = grid.update_cell({0, 0}, CellStatus::MOVING, unknown);
+    ASSERT_FALSE(rejected);
+    EXPECT_EQ(rejected.error(), "update_cells: color is not in the cell palette");
+}
+
+TEST(TetrisGridTest, DropDistanceFollowsColumnSurface) {
+    const Tetrimino t = tetrimino::make({3, 0}, TetriminoType::T);  // セルは列 3..5、行 0..1
+    const TetrisGrid empty = make_grid();
+    EXPECT_EQ(empty.drop_distance(t), 18);
+    EXPECT_EQ(empty.landing_position(t).pos.y, 18);
+
+    // 列 4（T の凸の真下）に積むと、その分だけ手前で止まる
+    const TetrisGrid stacked = fill_cells(empty, {{4, 15}, {4, 16}});
+    EXPECT_EQ(stacked.drop_distance(t), 13);
+    EXPECT_FALSE(stacked.can_place(tetrimino::move(t, 0, 14)));
+    EXPECT_TRUE(stacked.can_place(stacked.landing_position(t)));
+
+    // 最上段を消すと下のセルまで surface が戻る
+    const TetrisGrid cleared = stacked.update_cell({4, 15}, CellStatus::EMPTY, {}).value();
+    EXPECT_EQ(cleared.drop_distance(t), 14);
+}
+
+TEST(TetrisGridTest, DropDistanceUnderOverhangFallsBackToBitboard) {
+    // 列 0..2 の行 10 に屋根。その下に潜り込んだ O は床まで落ちる
+    const TetrisGrid grid = fill_cells(make_grid(), {{0, 10}, {1, 10}, {2, 10}});
+    const Tetrimino o = tetrimino::make({0, 12}, TetriminoType::O);
+    ASSERT_TRUE(grid.can_place(o));
+    EXPECT_EQ(grid.drop_distance(o), 6);
+
+    // 行消去後も surface は作り直される
+    std::vector<GridColumnRow> bottom_row;
+    for (int column = 0; column < 10; ++column) bottom_row.push_back({column, 19});
+    const RowClearResult result = fill_cells(grid, bottom_row).clear_full_rows();
+    ASSERT_EQ(result.cleared_rows, 1);
+    EXPECT_EQ(result.grid.drop_distance(tetrimino::make({0, 0}, TetriminoType::O)), 9);
+}
+
+TEST(TetrisGridTest, RenderBatchesCellsIntoTwoDrawCalls) {
+    const TetrisGrid grid = fill_cells(make_grid(), {{0, 19}, {1, 19}, {2, 19}});
+    RecordingRenderer renderer(300, 600);
+    renderer.begin_frame();
+    grid.render(renderer);
+    renderer.end_frame();
+
+    const auto cells = static_cast<std::size_t>(grid.grid_size.column * grid.grid_size.row);
+    EXPECT_EQ(renderer.frames().back().draw_calls, 2u);
+    EXPECT_EQ(renderer.frames().back().primitives, cells);
+    const std::string dump = renderer.dump();
+    EXPECT_NE(dump.find("fill_rects 3\n"
+                        "  0,570 30x30 #ff0000ff\n"
+                        "  30,570 30x30 #ff0000ff\n"
+                        "  60,570 30x30 #ff0000ff\n"),
+              std::string::npos)
+        << dump;
+    EXPECT_NE(dump.find("stroke_rects " + std::to_string(cells - 3) + " #000000ff\n"),
+              std::string::npos);
+}
+
+TEST(TetrisGridTest, LocalPolicyGridMatchesSharedGrid) {
+    const GameConfig& config = game_config::defaultGameConfig;
+    const TetrisGrid shared = TetrisGrid::create("shared", config).value();
+    const LocalTetrisGrid local = LocalTetrisGrid::create("local", config).value();
+
+    // 最下段を 1 列だけ残して埋め、最後の列で揃えて行消去する
+    const Color red = tetrimino::color_of(TetriminoType::Z);
+    std::vector<CellUpdate> updates;
+    for (int column = 0; column < shared.grid_size.column; ++column) {
+        updates.push_back({{column, 19}, CellStatus::MOVING, red});
+        updates.push_back({{column, 19}, CellStatus::FILLED, red});
+    }
+    updates.push_back({{3, 18}, CellStatus::MOVING, red});
+
+    const auto shared_result = shared.update_cells(updates).value().clear_full_rows();
+    const auto local_result = local.update_cells(updates).value().clear_full_rows();
+    ASSERT_EQ(shared_result.cleared_rows, 1);
+    ASSERT_EQ(local_result.cleared_rows, 1);
+    for (int row = 0; row < shared.grid_size.row; ++row) {
+        const GridBitboard& expected = shared_result.grid.occupancy;
+        EXPECT_EQ(expected.filled[row], local_result.grid.occupancy.filled[row]);
+        EXPECT_EQ(expected.moving[row], local_result.grid.occupancy.moving[row]);
+        for (int column = 0; column < shared.grid_size.column; ++column) {
+            EXPECT_EQ(shared_result.grid.cells[row][column].status(),
+                      local_result.grid.cells[row][column].status());
+        }
+    }
+    EXPECT_EQ(local_result.grid.cells[19][3].status(), CellStatus::MOVING);
+    EXPECT_FALSE(local.update_cells({CellUpdate{{3, 0}, CellStatus::FILLED, red}}));
+}
@@ -0,0 +1,74 @@
+// test/tetris_simulation_test.cpp
+#include <gtest/gtest.h>
+#include <core/GameConfig.hpp>
+#include <core/GameFarm.hpp>
+#include <core/TetrisSimulation.hpp>
+
+namespace {
+Input press(InputKey key) {
+    Input input;
+    input.key_down(key);
+    return input;
+}
+}  // namespace
+
+TEST(TetrisSimulationTest, GravityMovesPieceOnFixedTicks) {
+    auto sim = TetrisSimulation::create(game_config::defaultGameConfig, 7).value();
+    const double start_y = sim.current_tetrimino().pos.y;
+
+    // 1000 ms ごとに 1 行落ちる → 1 秒分のティック目で初めて動く
+    const int ticks_per_second = timestep::kTicksPerSecond;
+    for (int i = 0; i < ticks_per_second - 1; ++i) sim.step(Input{});
+    EXPECT_EQ(sim.current_tetrimino().pos.y, start_y);
+    sim.step(Input{});
+    EXPECT_EQ(sim.current_tetrimino().pos.y, start_y + 1);
+    EXPECT_EQ(sim.tick_count(), static_cast<std::uint64_t>(ticks_per_second));
+}
+
+TEST(TetrisSimulationTest, HardDropLocksAndSpawnsNext) {
+    auto sim = TetrisSimulation::create(game_config::defaultGameConfig, 7).value();
+    sim.step(press(InputKey::DROP));
+    EXPECT_EQ(sim.pieces_locked(), 1);
+    EXPECT_FALSE(sim.is_game_over());
+    EXPECT_EQ(sim.current_tetrimino().pos.y, 0);
+}
+
+TEST(TetrisSimulationTest, SameSeedAndInputsGiveSameGame) {
+    auto run = [](std::uint32_t seed) {
+        auto sim = TetrisSimulation::create(game_config::defaultGameConfig, seed).value();
+        while (!sim.is_game_over()) sim.step(press(InputKey::DROP));
+        return std::make_pair(sim.tick_count(), sim.pieces_locked());
+    };
+    EXPECT_EQ(run(3), run(3));
+    EXPECT_GT(run(3).second, 0);
+}
+
+TEST(GameFarmTest, ResultsDoNotDependOnThreadCount) {
+    std::vector<GameJob> jobs;
+    for (std::uint32_t seed = 0; seed < 40; ++seed) jobs.push_back({seed, 5000});
+    const auto hard_drop = [](std::uint32_t) -> GameFarm::Policy {
+        return [](const TetrisSimulation&) { return press(InputKey::DROP); };
+    };
+
+    const auto single = GameFarm(1, 3).run(game_config::defaultGameConfig, jobs, hard_drop);
+    const auto multi = GameFarm(4, 3).run(game_config::defaultGameConfig, jobs, hard_drop);
+    ASSERT_TRUE(single.has_value());
+    ASSERT_TRUE(multi.has_value());
+    ASSERT_EQ(multi->results.size(), jobs.size());
+    EXPECT_EQ(single->total_pieces, multi->total_pieces);
+    EXPECT_EQ(single->total_ticks, multi->total_ticks);
+    EXPECT_EQ(multi->topped_out_games, jobs.size());
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        EXPECT_EQ(multi->results[i].seed, jobs[i].seed);
+        EXPECT_EQ(multi->results[i].ticks, single->results[i].ticks);
+    }
+
+    // ワーカーごとの統計: 全ゲームがどれか 1 つのワーカーで回っている
+    ASSERT_EQ(single->workers.size(), 1u);
+    EXPECT_EQ(single->workers[0].games, jobs.size());
+    EXPECT_EQ(single->workers[0].stolen_chunks, 0u);
+    ASSERT_EQ(multi->workers.size(), 4u);
+    std::size_t games = 0;
+    for (const WorkerStats& worker : multi->workers) games += worker.games;
+    EXPECT_EQ(games, jobs.size());
+}
@@ -0,0 +1,176 @@
+// test/text_layout_test.cpp
+#include <gtest/gtest.h>
+#include <core/render/TextLayout.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+std::vector<char32_t> decode(std::string_view utf8) {
+    std::vector<char32_t> out;
+    decode_utf8(utf8, out);
+    return out;
+}
+
+TextLayout layout_with(std::size_t quads) {
+    TextLayout layout;
+    layout.quads.resize(quads);
+    return layout;
+}
+
+/// GlyphAtlas と同じく、一杯になったら空にして詰め直す小さなアトラス（8×8 のグリフが 2 個入る）
+class TinyAtlas {
+   public:
+    struct Glyph {
+        int x, y, width, height, advance;
+    };
+
+    [[nodiscard]] std::uint32_t generation() const noexcept { return generation_; }
+    [[nodiscard]] int line_height() const noexcept { return 8; }
+    [[nodiscard]] int kerning(char32_t, char32_t) const noexcept { return 0; }
+
+    const Glyph& glyph(char32_t code) {
+        if (const auto it = glyphs_.find(code); it != glyphs_.end()) return it->second;
+        auto placement = packer_.insert(8, 8);
+        if (!placement) {
+            packer_.reset();
+            glyphs_.clear();
+            ++generation_;
+            placement = packer_.insert(8, 8);
+        }
+        return glyphs_.emplace(code, Glyph{placement->x, placement->y, 8, 8, 8}).first->second;
+    }
+
+   private:
+    ShelfPacker packer_{16, 8, 0};
+    std::unordered_map<char32_t, Glyph> glyphs_;
+    std::uint32_t generation_ = 0;
+};
+}  // namespace
+
+TEST(TextLayoutTest, DecodesAsciiAndJapanese) {
+    EXPECT_EQ(decode("Score"), (std::vector<char32_t>{U'S', U'c', U'o', U'r', U'e'}));
+    EXPECT_EQ(decode("\xE3\x83\x86\xE3\x83\x88"), (std::vector<char32_t>{U'テ', U'ト'}));
+    EXPECT_EQ(decode("\xF0\x9F\x8E\xAE"), (std::vector<char32_t>{U'\U0001F3AE'}));
+}
+
+TEST(TextLayoutTest, InvalidSequencesBecomeReplacementCharacters) {
+    // 途中で切れた列、冗長な表現、孤立した継続バイト
+    EXPECT_EQ(decode("\xE3\x83"), (std::vector<char32_t>{0xFFFD}));
+    EXPECT_EQ(decode("\xC0\xAF"), (std::vector<char32_t>{0xFFFD}));
+    EXPECT_EQ(decode("a\x80" "b"), (std::vector<char32_t>{U'a', 0xFFFD, U'b'}));
+}
+
+TEST(TextLayoutTest, ShelfPackerFillsShelvesThenFails) {
+    ShelfPacker packer(32, 16, 0);
+    const auto a = packer.insert(16, 8);
+    const auto b = packer.insert(16, 8);
+    const auto c = packer.insert(16, 8);
+    ASSERT_TRUE(a && b && c);
+    EXPECT_EQ(a->y, 0);
+    EXPECT_EQ(b->x, 16);
+    EXPECT_EQ(b->y, 0);
+    EXPECT_EQ(c->y, 8);
+    ASSERT_TRUE(packer.insert(16, 8));
+    EXPECT_FALSE(packer.insert(1, 1));
+
+    packer.reset();
+    EXPECT_TRUE(packer.insert(32, 16));
+}
+
+TEST(TextLayoutTest, ShelfPackerKeepsTallGlyphsOffShortShelves) {
+    ShelfPacker packer(64, 64, 1);
+    const auto short_glyph = packer.insert(8, 8);
+    const auto tall_glyph = packer.insert(8, 20);
+    ASSERT_TRUE(short_glyph && tall_glyph);
+    EXPECT_NE(short_glyph->y, tall_glyph->y);
+    // 高さの近いグリフは既存の棚に並ぶ
+    const auto similar = packer.insert(8, 18);
+    ASSERT_TRUE(similar);
+    EXPECT_EQ(similar->y, tall_glyph->y);
+}
+
+TEST(TextLayoutTest, CacheCountsHitsAndMisses) {
+    TextLayoutCache cache;
+    EXPECT_EQ(cache.find(0, "FPS 60"), nullptr);
+    ASSERT_NE(cache.insert(0, "FPS 60", layout_with(6)), nullptr);
+    const TextLayout* hit = cache.find(0, "FPS 60");
+    ASSERT_NE(hit, nullptr);
+    EXPECT_EQ(hit->quads.size(), 6u);
+    // 同じ文字列でもフォントが違えば別物
+    EXPECT_EQ(cache.find(1, "FPS 60"), nullptr);
+
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(cache.stats().misses, 2u);
+    EXPECT_EQ(cache.stats().entries, 1u);
+}
+
+TEST(TextLayoutTest, CacheKeepsItsOwnCopyOfLongKeys) {
+    TextLayoutCache cache;
+    {
+        // SSO に収まらない長さ。登録後に呼び出し側の文字列が消えても引けること
+        std::string text = "Press SPACE to start the game";
+        ASSERT_NE(cache.insert(0, text, layout_with(3)), nullptr);
+        text.assign(text.size(), '?');
+    }
+    const TextLayout* hit = cache.find(0, "Press SPACE to start the game");
+    ASSERT_NE(hit, nullptr);
+    EXPECT_EQ(hit->quads.size(), 3u);
+    EXPECT_EQ(cache.find(0, "Press SPACE to start the gam"), nullptr);
+}
+
+TEST(TextLayoutTest, CacheEvictsLeastRecentlyUsedWithinBudget) {
+    const std::size_t one = layout_with(16).bytes();
+    TextLayoutCache cache(one * 3);
+    cache.insert(0, "a", layout_with(16));
+    cache.insert(0, "b", layout_with(16));
+    ASSERT_NE(cache.find(0, "a"), nullptr);  // a を最新にする
+    cache.insert(0, "c", layout_with(16));
+
+    EXPECT_LE(cache.stats().bytes, one * 3);
+    EXPECT_GE(cache.stats().evictions, 1u);
+    EXPECT_EQ(cache.find(0, "b"), nullptr);
+    EXPECT_NE(cache.find(0, "a"), nullptr);
+    EXPECT_NE(cache.find(0, "c"), nullptr);
+
+    // 予算を超える 1 件は保持しない
+    EXPECT_EQ(cache.insert(0, "huge", layout_with(4096)), nullptr);
+}
+
+TEST(TextLayoutTest, EraseFontDropsOnlyThatFont) {
+    TextLayoutCache cache;
+    cache.insert(0, "x", layout_with(1));
+    cache.insert(1, "x", layout_with(1));
+    cache.erase_font(0);
+    EXPECT_EQ(cache.find(0, "x"), nullptr);
+    EXPECT_NE(cache.find(1, "x"), nullptr);
+    EXPECT_EQ(cache.stats().entries, 1u);
+}
+
+TEST(TextLayoutTest, LayoutStartsOverAfterTheAtlasIsReset) {
+    TinyAtlas atlas;
+    ASSERT_TRUE(layout_glyphs(atlas, decode("ab")));
+    // c で一杯になり作り直す。a, b の座標は無効なので、c, d だけを空のアトラスに並べ直す
+    const auto layout = layout_glyphs(atlas, decode("cd"));
+    ASSERT_TRUE(layout);
+    EXPECT_EQ(atlas.generation(), 1u);
+    ASSERT_EQ(layout->quads.size(), 2u);
+    EXPECT_EQ(layout->quads[0].src_x, 0.0f);
+    EXPECT_EQ(layout->quads[1].src_x, 8.0f);
+    EXPECT_EQ(layout->width, 16);
+}
+
+TEST(TextLayoutTest, LayoutReportsAStringThatOverflowsTheAtlasTwice) {
+    TinyAtlas atlas;
+    TextLayoutCache cache;
+    const std::uint32_t generation = atlas.generation();
+    cache.insert(0, "ab", *layout_glyphs(atlas, decode("ab")));
+
+    // 3 文字は 1 枚に入らない。並べ直しの途中でもう一度作り直すので、結果は返らない
+    EXPECT_FALSE(layout_glyphs(atlas, decode("abc")));
+    EXPECT_EQ(atlas.generation(), generation + 2);
+
+    // SDLRenderer::draw_text と同じく、作り直しを見たらこのフォントのレイアウトを捨てる
+    if (atlas.generation() != generation) cache.erase_font(0);
+    EXPECT_EQ(cache.find(0, "ab"), nullptr);
+}
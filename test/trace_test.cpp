@@ -0,0 +1,74 @@
+// test/trace_test.cpp
+#include <gtest/gtest.h>
+#include <core/Trace.hpp>
+#include <sstream>
+#include <thread>
+
+TEST(TraceTest, ZonesAreCollectedInStartOrderPerThread) {
+    trace::clear();
+    {
+        trace::Zone outer("test", "outer");
+        { trace::Zone inner("test", "inner"); }
+    }
+    std::thread([] { trace::Zone worker("test", "worker"); }).join();
+
+    const auto events = trace::collect();
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_STREQ(events[0].second.name, "outer");
+    EXPECT_STREQ(events[1].second.name, "inner");
+    EXPECT_STREQ(events[2].second.name, "worker");
+    EXPECT_EQ(events[0].first, events[1].first);
+    EXPECT_NE(events[0].first, events[2].first);
+    // 入れ子のゾーンは外側の区間に収まる
+    EXPECT_LE(events[0].second.start_us, events[1].second.start_us);
+    EXPECT_GE(events[0].second.start_us + events[0].second.duration_us,
+              events[1].second.start_us + events[1].second.duration_us);
+}
+
+TEST(TraceTest, TiedZonesKeepNestingAndRecordOrder) {
+    trace::clear();
+    const auto now = trace::Clock::now();
+    // 同時刻に始まった長さ 0 の兄弟 2 つと、それを包む同じく長さ 0 の親（内側から終わる順に記録）
+    trace::record("test", "first", now, now, 1);
+    trace::record("test", "second", now, now, 1);
+    trace::record("test", "parent", now, now, 0);
+
+    const auto events = trace::collect();
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_STREQ(events[0].second.name, "parent");
+    EXPECT_STREQ(events[1].second.name, "first");
+    EXPECT_STREQ(events[2].second.name, "second");
+}
+
+TEST(TraceTest, RingKeepsOnlyTheLatestEvents) {
+    trace::clear();
+    const auto now = trace::Clock::now();
+    for (std::size_t i = 0; i < trace::kRingCapacity + 10; ++i) {
+        trace::record("test", i < 10 ? "dropped" : "kept", now, now);
+    }
+    const auto events = trace::collect();
+    ASSERT_EQ(events.size(), trace::kRingCapacity);
+    for (const auto& [thread_id, event] : events) EXPECT_STREQ(event.name, "kept");
+}
+
+TEST(TraceTest, DisabledZonesRecordNothing) {
+    trace::clear();
+    trace::set_enabled(false);
+    { trace::Zone zone("test", "ignored"); }
+    trace::set_enabled(true);
+    EXPECT_TRUE(trace::collect().empty());
+}
+
+TEST(TraceTest, WritesChromeTraceEventJson) {
+    trace::clear();
+    { trace::Zone zone("scene", "quote\"name"); }
+
+    std::ostringstream out;
+    trace::write_chrome_json(out);
+    const std::string json = out.str();
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"cat\":\"scene\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"quote\\\"name\""), std::string::npos);
+    EXPECT_NE(json.find("\"displayTimeUnit\":\"ms\"}"), std::string::npos);
+}
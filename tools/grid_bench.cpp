@@ -0,0 +1,231 @@
+// tools/grid_bench.cpp
+// 更新の多い負荷で、盤面の immer メモリポリシーを比べる。
+//
+//   grid_bench [--pieces N] [--seed S] [--threads W] [--history H]
+//
+// 幅 1〜4 の横長のピースを 1 行ずつ落とし（1 行ごとに最大 8 セルを update_cells）、
+// 着地したら固定して行消去する。
+// 同じ手順を TetrisGrid（immer の既定: atomic の参照カウント＋スレッド安全な空きリスト）と
+// LocalTetrisGrid（非 atomic の参照カウント。ノードのヒープは既定のまま）に流し、1 更新あたりの
+// 時間を並べる。直近 H 個の盤面を保持して、古い盤面のノードが後から解放される状況も作る。
+// 各スレッドは自分の盤面だけを更新する。lines / resets は両ポリシーで一致する。
+//
+// 続けて、2 つのポリシーで違う部品（参照カウント）を immer を通さずに単体で比べる。
+// immer の refcount_policy と同じ atomic の増減と、unsafe_refcount_policy と同じ非 atomic の増減。
+// 盤面の比較はリンクした immer の実装に依存する（メモリポリシーを無視する immer では差が出ない）
+// が、部品の比較はどの immer でも同じ結果になる。
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <core/BoardMemoryPolicy.hpp>
+#include <core/GameConfig.hpp>
+#include <core/TetrisGrid.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+struct Options {
+    int pieces = 20000;  ///< スレッドごとに落とすピース数
+    std::uint32_t seed = 1;
+    unsigned threads = 1;
+    std::size_t history = 8;  ///< 保持しておく過去の盤面の数
+};
+
+Options parse_options(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string name = argv[i];
+        const char* value = argv[i + 1];
+        if (name == "--pieces") options.pieces = std::atoi(value);
+        if (name == "--seed") {
+            options.seed = static_cast<std::uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        if (name == "--threads") {
+            const auto threads = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+            options.threads = std::max(1u, threads);
+        }
+        if (name == "--history") options.history = std::strtoull(value, nullptr, 10);
+    }
+    return options;
+}
+
+struct Totals {
+    std::uint64_t updates = 0;  ///< update_cells / clear_full_rows で盤面を作った回数
+    std::uint64_t lines = 0;
+    std::uint64_t resets = 0;  ///< 積み上がって出現できず、空の盤面からやり直した回数
+};
+
+/// 横長のピース（列 column から width セル）を同じ状態にする更新要求を updates に書く
+void set_piece(CellUpdate* updates, int column, int width, int row, CellStatus status) {
+    for (int i = 0; i < width; ++i) {
+        updates[i] = CellUpdate{{column + i, row}, status, colors::kCyan};
+    }
+}
+
+/// 1 スレッド分の負荷。Grid は BasicTetrisGrid<MemoryPolicy>
+template <typename Grid>
+Totals play(const GameConfig& config, std::uint32_t seed, const Options& options) {
+    std::mt19937 engine(seed);
+    const Grid empty = Grid::create("bench", config).value();
+    std::deque<Grid> boards{empty};
+    Totals totals;
+
+    const auto push = [&](Grid grid) {
+        boards.push_back(std::move(grid));
+        if (boards.size() > options.history + 1) boards.pop_front();
+        ++totals.updates;
+    };
+
+    const int columns = empty.grid_size.column;
+    const int rows = empty.grid_size.row;
+    for (int piece = 0; piece < options.pieces; ++piece) {
+        const int width = 1 + static_cast<int>(engine() % 4);
+        const int column = static_cast<int>(engine() % static_cast<unsigned>(columns - width + 1));
+        const auto count = static_cast<std::size_t>(width);
+        std::array<CellUpdate, 8> updates;
+
+        set_piece(updates.data(), column, width, 0, CellStatus::MOVING);
+        auto spawned = boards.back().update_cells(updates.data(), count);
+        if (!spawned) {
+            ++totals.resets;
+            push(empty);
+            continue;
+        }
+        push(std::move(*spawned));
+
+        int row = 0;
+        for (;;) {
+            const Grid& grid = boards.back();
+            bool blocked = row + 1 >= rows;
+            for (int i = 0; i < width && !blocked; ++i) {
+                blocked = grid.is_filled_cell({column + i, row + 1});
+            }
+            if (blocked) break;
+
+            set_piece(updates.data(), column, width, row, CellStatus::EMPTY);
+            set_piece(updates.data() + width, column, width, row + 1, CellStatus::MOVING);
+            push(grid.update_cells(updates.data(), 2 * count).value());
+            ++row;
+        }
+
+        set_piece(updates.data(), column, width, row, CellStatus::FILLED);
+        auto cleared = boards.back().update_cells(updates.data(), count).value().clear_full_rows();
+        totals.lines += static_cast<std::uint64_t>(cleared.cleared_rows);
+        push(std::move(cleared.grid));
+    }
+    return totals;
+}
+
+struct Measurement {
+    Totals totals;
+    double seconds;
+};
+
+/// options.threads 本のスレッドでそれぞれ play<Grid> を回し、合計と経過時間を返す
+template <typename Grid>
+Measurement measure(const GameConfig& config, const Options& options) {
+    std::vector<Totals> results(options.threads);
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < options.threads; ++t) {
+        workers.emplace_back(
+            [&, t] { results[t] = play<Grid>(config, options.seed + t, options); });
+    }
+    for (std::thread& worker : workers) worker.join();
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    Measurement measurement{{}, seconds};
+    for (const Totals& totals : results) {
+        measurement.totals.updates += totals.updates;
+        measurement.totals.lines += totals.lines;
+        measurement.totals.resets += totals.resets;
+    }
+    return measurement;
+}
+
+// ──────────── 参照カウントの比較 ────────────
+
+/**
+ * counters の各要素を 1 増やしてから 1 減らす（ノードを共有して捨てるときの参照カウント）を
+ * rounds 回繰り返し、1 回の増減あたりの秒数を返す
+ */
+template <typename Counter, typename Increment, typename Decrement>
+double refcount_churn(std::vector<Counter>& counters, int rounds, Increment increment,
+                      Decrement decrement) {
+    std::uint64_t released = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (Counter& counter : counters) increment(counter);
+        for (Counter& counter : counters) released += decrement(counter) ? 1 : 0;
+    }
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (released != 0) std::cerr << "refcount reached zero\n";  // 最適化で消されないように使う
+    return seconds / (static_cast<double>(rounds) * static_cast<double>(counters.size()));
+}
+
+void report_components(std::uint64_t updates) {
+    // 盤面 1 枚ぶん程度のノード数。参照カウントはノードの先頭にある int
+    constexpr std::size_t kNodes = 64;
+    const int rounds = static_cast<int>(std::max<std::uint64_t>(1, updates / 8));
+    std::vector<std::atomic<int>> atomic_counts(kNodes);
+    for (std::atomic<int>& count : atomic_counts) count.store(1);
+    std::vector<int> plain_counts(kNodes, 1);
+    const double atomic = refcount_churn(
+        atomic_counts, rounds,
+        [](std::atomic<int>& count) { count.fetch_add(1, std::memory_order_relaxed); },
+        [](std::atomic<int>& count) {
+            return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        });
+    const double plain = refcount_churn(
+        plain_counts, rounds, [](int& count) { ++count; }, [](int& count) { return --count == 0; });
+
+    std::cout << "components (independent of the linked immer)\n"
+              << "  refcount inc+dec  atomic: " << atomic * 1e9 << " ns  plain: " << plain * 1e9
+              << " ns  speedup: " << atomic / plain << "x\n";
+}
+
+void report(const char* name, const Measurement& m) {
+    const double ns_per_update =
+        m.totals.updates > 0 ? m.seconds * 1e9 / static_cast<double>(m.totals.updates) : 0.0;
+    std::cout << name << '\n'
+              << "  updates:    " << m.totals.updates << '\n'
+              << "  lines:      " << m.totals.lines << '\n'
+              << "  resets:     " << m.totals.resets << '\n'
+              << "  seconds:    " << m.seconds << '\n'
+              << "  ns/update:  " << ns_per_update << '\n';
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    const Options options = parse_options(argc, argv);
+    const GameConfig& config = game_config::defaultGameConfig;
+
+    // 1 回目は空きリストとキャッシュを温めるだけ
+    static_cast<void>(measure<TetrisGrid>(config, options));
+    static_cast<void>(measure<LocalTetrisGrid>(config, options));
+    const Measurement shared = measure<TetrisGrid>(config, options);
+    const Measurement local = measure<LocalTetrisGrid>(config, options);
+
+    std::cout << "threads: " << options.threads << "  pieces/thread: " << options.pieces
+              << "  history: " << options.history << '\n';
+    report("TetrisGrid (shared policy)", shared);
+    report("LocalTetrisGrid (local policy)", local);
+    if (shared.totals.lines != local.totals.lines ||
+        shared.totals.resets != local.totals.resets) {
+        std::cerr << "policies disagree on the result\n";
+        return 1;
+    }
+    const double speedup = local.seconds > 0 ? shared.seconds / local.seconds : 0.0;
+    std::cout << "speedup: " << speedup << "x\n";
+    report_components(shared.totals.updates / options.threads);
+    return 0;
+}
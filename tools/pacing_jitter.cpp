@@ -0,0 +1,68 @@
+// tools/pacing_jitter.cpp
+// FramePacer の TARGET_FPS で実際に待ち、フレーム時間のジッタ（標準偏差）を測る。
+//
+//   pacing_jitter [--frames N] [--work-ms W] [--target-ms J]
+//
+// 60 Hz と 144 Hz でそれぞれ N フレーム回す。各フレームでは W ミリ秒のビジーループを
+// ゲームの処理の代わりに入れる。標準偏差が J ミリ秒（既定 0.5）を超えたレートがあれば
+// 終了コード 1 を返す。計測値は OS のスケジューラと負荷に左右されるので、
+// 単体テストではなくこのツールで確認する。
+#include <chrono>
+#include <core/FramePacer.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace {
+struct Options {
+    int frames = 600;
+    double work_ms = 2.0;
+    double target_ms = 0.5;
+};
+
+Options parse_options(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string name = argv[i];
+        const char* value = argv[i + 1];
+        if (name == "--frames") options.frames = std::atoi(value);
+        if (name == "--work-ms") options.work_ms = std::atof(value);
+        if (name == "--target-ms") options.target_ms = std::atof(value);
+    }
+    return options;
+}
+
+/// ゲームの 1 フレーム分の処理の代わりに CPU を回す
+void busy_work(double ms) {
+    using frame_pacing::Clock;
+    const Clock::time_point until =
+        Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                           std::chrono::duration<double, std::milli>(ms));
+    while (Clock::now() < until) {
+    }
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    const Options options = parse_options(argc, argv);
+
+    bool within_target = true;
+    for (const double fps : {60.0, 144.0}) {
+        FramePacer pacer(PacingMode::TARGET_FPS, fps);
+        pacer.wait_for_next_frame();
+        pacer.reset_stats();
+        for (int frame = 0; frame < options.frames; ++frame) {
+            busy_work(options.work_ms);
+            pacer.wait_for_next_frame();
+        }
+
+        const FrameTimeStats& stats = pacer.stats();
+        const bool ok = stats.stddev_ms() < options.target_ms;
+        within_target = within_target && ok;
+        std::cout << fps << " Hz: period " << 1000.0 / fps << " ms, mean " << stats.mean_ms
+                  << " ms, jitter (stddev) " << stats.stddev_ms() << " ms, min " << stats.min_ms
+                  << " ms, max " << stats.max_ms << " ms, spin " << pacer.spin_threshold().count()
+                  << " us" << (ok ? "" : "  [over target]") << '\n';
+    }
+    return within_target ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+// tools/tetris_sim.cpp
+// ヘッドレスで TetrisSimulation を回し、ゲーム数/秒・ティック数/秒を報告する。
+//
+//   tetris_sim [--games N] [--seed S] [--max-ticks T] [--threads W] [--scaling 1]
+//
+// 入力はシードから決まる疑似乱数のボット（ランダムに左右・回転・ハードドロップ）なので、
+// 同じ引数なら lines / pieces の合計は常に一致する（回帰確認に使える）。--threads を変えても同じ。
+// --scaling 1 ではワーカー数を 1, 2, 4, ... と W（省略時はハードウェアのスレッド数）まで増やし、
+// 同じジョブを回したときの games/s と 1 ワーカー比の速度向上・並列効率を並べる。
+#include <algorithm>
+#include <chrono>
+#include <core/GameConfig.hpp>
+#include <core/GameFarm.hpp>
+#include <core/Input.hpp>
+#include <core/TetrisSimulation.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+struct Options {
+    int games = 1000;
+    std::uint32_t seed = 1;
+    std::uint64_t max_ticks = 100000;
+    unsigned threads = 0;  ///< 0 ならハードウェアのスレッド数
+    bool scaling = false;  ///< ワーカー数ごとのスケーリングを測る
+};
+
+Options parse_options(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string name = argv[i];
+        const char* value = argv[i + 1];
+        if (name == "--games") options.games = std::atoi(value);
+        if (name == "--seed") {
+            options.seed = static_cast<std::uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        if (name == "--max-ticks") options.max_ticks = std::strtoull(value, nullptr, 10);
+        if (name == "--threads") {
+            options.threads = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+        }
+        if (name == "--scaling") options.scaling = std::atoi(value) != 0;
+    }
+    return options;
+}
+
+/// 1 ティック分のボット入力（平均 16 ティックに 1 回ハードドロップ）
+Input bot_input(std::mt19937& engine) {
+    Input input;
+    switch (engine() % 16) {
+        case 0:
+            input.key_down(InputKey::LEFT);
+            break;
+        case 1:
+            input.key_down(InputKey::RIGHT);
+            break;
+        case 2:
+            input.key_down(InputKey::ROTATE_RIGHT);
+            break;
+        case 3:
+            input.key_down(InputKey::DROP);
+            break;
+        default:
+            break;
+    }
+    return input;
+}
+
+GameFarm::Policy bot(std::uint32_t seed) {
+    return [engine = std::mt19937(seed)](const TetrisSimulation&) mutable {
+        return bot_input(engine);
+    };
+}
+
+struct TimedRun {
+    tl::expected<FarmSummary, std::string> summary;
+    double seconds;
+};
+
+TimedRun timed_run(const GameFarm& farm, const std::vector<GameJob>& jobs) {
+    const auto start = std::chrono::steady_clock::now();
+    auto summary = farm.run(game_config::defaultGameConfig, jobs, bot);
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return TimedRun{std::move(summary), seconds};
+}
+
+/// ワーカー数を倍々に増やして同じジョブを回し、スループットの伸びを表にする
+int run_scaling(const Options& options, const std::vector<GameJob>& jobs) {
+    const unsigned max_threads = GameFarm(options.threads).thread_count();
+    std::cout << "threads  games/s  speedup  efficiency  steals\n";
+    double baseline = 0.0;
+    std::uint64_t baseline_pieces = 0;
+    for (unsigned threads = 1;; threads = std::min(threads * 2, max_threads)) {
+        const TimedRun run = timed_run(GameFarm(threads), jobs);
+        if (!run.summary) {
+            std::cerr << run.summary.error() << '\n';
+            return 1;
+        }
+        const double games_per_second = run.seconds > 0 ? options.games / run.seconds : 0.0;
+        if (threads == 1) {
+            baseline = games_per_second;
+            baseline_pieces = run.summary->total_pieces;
+        } else if (run.summary->total_pieces != baseline_pieces) {
+            std::cerr << "results differ between worker counts\n";
+            return 1;
+        }
+        std::size_t steals = 0;
+        for (const WorkerStats& worker : run.summary->workers) steals += worker.stolen_chunks;
+        const double speedup = baseline > 0 ? games_per_second / baseline : 0.0;
+        std::cout << threads << "  " << games_per_second << "  " << speedup << "x  "
+                  << speedup / threads << "  " << steals << '\n';
+        if (threads == max_threads) break;  // 最後は max_threads ちょうどで測る
+    }
+    return 0;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    const Options options = parse_options(argc, argv);
+
+    std::vector<GameJob> jobs;
+    for (int game = 0; game < options.games; ++game) {
+        jobs.push_back({options.seed + static_cast<std::uint32_t>(game), options.max_ticks});
+    }
+    if (options.scaling) return run_scaling(options, jobs);
+
+    const GameFarm farm(options.threads);
+    const TimedRun run = timed_run(farm, jobs);
+    const auto& summary = run.summary;
+    const double seconds = run.seconds;
+    if (!summary) {
+        std::cerr << summary.error() << '\n';
+        return 1;
+    }
+
+    std::cout << "threads: " << farm.thread_count() << '\n'
+              << "games:   " << options.games << '\n'
+              << "ticks:   " << summary->total_ticks << '\n'
+              << "pieces:  " << summary->total_pieces << '\n'
+              << "lines:   " << summary->total_lines << '\n'
+              << "topouts: " << summary->topped_out_games << '\n'
+              << "seconds: " << seconds << '\n'
+              << "games/s: " << (seconds > 0 ? options.games / seconds : 0.0) << '\n'
+              << "ticks/s: "
+              << (seconds > 0 ? static_cast<double>(summary->total_ticks) / seconds : 0.0) << '\n';
+    return 0;
+}